@@ -0,0 +1,12 @@
+#!/bin/bash
+# Times the compiler alone, ROUNDS times over each bench/compile/*.stkn, which
+# are heavy on instantiation rather than on the generated program.  Run from
+# the repository root after `make`.
+
+ROUNDS=${ROUNDS:-50}
+
+for b in bench/compile/*.stkn; do
+    echo $(basename $b .stkn)":"
+    ./stkn-core.out $STKN_OPTIONS < $b > /dev/null || exit 1
+    time (for i in $(seq $ROUNDS); do ./stkn-core.out $STKN_OPTIONS < $b > /dev/null; done)
+done
@@ -0,0 +1,42 @@
+#!/bin/bash
+# Times each bench/*.stkn compiled as is, compiled with memoization, and
+# compiled without the SIMD kernels, parallel pipelines, frame arenas, moves on
+# last reads, self tail calls, typed frames, plain functions and compact frame
+# bases.  Then counts the list blocks allocated from frame arenas and from the
+# heap, and the memo table hits.  Run from the repository root after `make`.
+
+# Without self tail calls, the million-deep recursion in tail-call.stkn needs
+# more than the default stack.
+ulimit -s unlimited 2>/dev/null || ulimit -s $(ulimit -Hs)
+
+BASE_OPTIONS="--no-simd-kernel --no-parallel-pipe --no-frame-arena --no-move-last-read --no-tail-call --no-typed-frame --no-plain-func --no-compact-bases"
+
+for b in bench/*.stkn; do
+    echo $(basename $b .stkn)":"
+    STKN_CXXFLAGS=-O2 ./stkn.sh $b tmp.opt.out || exit 1
+    STKN_CXXFLAGS=-O2 STKN_OPTIONS="$BASE_OPTIONS" ./stkn.sh $b tmp.base.out || exit 1
+    if ! ./tmp.opt.out | diff - <(./tmp.base.out) > /dev/null;
+    then
+        echo "    output mismatch!"
+        exit 1
+    fi
+    echo "    base"
+    time ./tmp.base.out > /dev/null
+    echo "    single thread"
+    time STKN_THREADS=1 ./tmp.opt.out > /dev/null
+    echo "    all threads"
+    time ./tmp.opt.out > /dev/null
+
+    STKN_CXXFLAGS=-O2 STKN_OPTIONS="--memoize" ./stkn.sh $b tmp.opt.out || exit 1
+    echo "    memoized"
+    time ./tmp.opt.out > /dev/null
+
+    STKN_CXXFLAGS="-O2 -DSTKN_ALLOC_STATS -DSTKN_MEMO_STATS" STKN_OPTIONS="--memoize" ./stkn.sh $b \
+        tmp.opt.out || exit 1
+    STKN_CXXFLAGS="-O2 -DSTKN_ALLOC_STATS" STKN_OPTIONS="--no-frame-arena" ./stkn.sh $b tmp.base.out \
+        || exit 1
+    echo "    allocations with frame arenas"
+    ./tmp.opt.out 2>&1 > /dev/null | sed 's/^/        /'
+    echo "    allocations without"
+    ./tmp.base.out 2>&1 > /dev/null | sed 's/^/        /'
+done
@@ -75,7 +75,7 @@ void Accumulator::addBlock(Accumulator b)
 }
 
 void Accumulator::defVar(misc::position const& pos
-                       , std::string const& name
+                       , util::symbol name
                        , util::sptr<Expression const> init)
 {
     _checkNotTerminated(pos);
@@ -83,8 +83,8 @@ void Accumulator::defVar(misc::position const& pos
 }
 
 util::sref<Function> Accumulator::defFunc(misc::position const& pos
-                                        , std::string const& name
-                                        , std::vector<std::string> const& param_names
+                                        , util::symbol name
+                                        , std::vector<util::symbol> const& param_names
                                         , util::sptr<Filter> body)
 {
     return _block.defFunc(pos, name, param_names, std::move(body));
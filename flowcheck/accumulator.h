@@ -5,6 +5,7 @@
 #include <vector>
 
 #include <util/pointer.h>
+#include <util/symbol.h>
 #include <misc/pos-type.h>
 
 #include "block.h"
@@ -47,12 +48,12 @@ namespace flchk {
         void addBlock(Accumulator b);
     public:
         void defVar(misc::position const& pos
-                  , std::string const& name
+                  , util::symbol name
                   , util::sptr<Expression const> init);
 
         util::sref<Function> defFunc(misc::position const& pos
-                                   , std::string const& name
-                                   , std::vector<std::string> const& param_names
+                                   , util::symbol name
+                                   , std::vector<util::symbol> const& param_names
                                    , util::sptr<Filter> body);
     public:
         void compileBlock(util::sref<proto::Block> block, util::sref<SymbolTable> st) const;
@@ -18,8 +18,8 @@ void Block::addStmt(util::sptr<Statement const> stmt)
 }
 
 util::sref<Function> Block::defFunc(misc::position const& pos
-                                  , std::string const& name
-                                  , std::vector<std::string> const& param_names
+                                  , util::symbol name
+                                  , std::vector<util::symbol> const& param_names
                                   , util::sptr<Filter> body)
 {
     _funcs.push_back(util::mkptr(new Function(pos, name, param_names, std::move(body))));
@@ -6,6 +6,7 @@
 
 #include <proto/fwd-decl.h>
 #include <util/pointer.h>
+#include <util/symbol.h>
 #include <misc/pos-type.h>
 
 #include "fwd-decl.h"
@@ -25,8 +26,8 @@ namespace flchk {
 
         void addStmt(util::sptr<Statement const> stmt);
         util::sref<Function> defFunc(misc::position const& pos
-                                   , std::string const& name
-                                   , std::vector<std::string> const& param_names
+                                   , util::symbol name
+                                   , std::vector<util::symbol> const& param_names
                                    , util::sptr<Filter> body);
         void append(Block following);
     private:
@@ -46,7 +46,7 @@ util::sptr<Filter> SelectorFunction::_mkBody(util::sref<SymbolTable> global_symb
     struct BuiltInRef
         : public Reference
     {
-        explicit BuiltInRef(std::string const& name)
+        explicit BuiltInRef(util::symbol name)
             : Reference(misc::position(), name)
         {}
     };
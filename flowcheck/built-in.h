@@ -28,7 +28,7 @@ namespace flchk {
         WriterFunction(util::sref<SymbolTable> global_symbols)
             : Function(misc::position()
                      , "write"
-                     , std::vector<std::string>({ "value to write" })
+                     , std::vector<util::symbol>({ "value to write" })
                      , _mkBody(global_symbols))
         {}
     private:
@@ -41,7 +41,7 @@ namespace flchk {
         SelectorFunction(util::sref<SymbolTable> global_symbols)
             : Function(misc::position()
                      , "ifte"
-                     , std::vector<std::string>({ "p", "c", "a" })
+                     , std::vector<util::symbol>({ "p", "c", "a" })
                      , _mkBody(global_symbols))
         {}
     private:
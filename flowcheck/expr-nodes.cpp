@@ -440,7 +440,7 @@ util::sptr<proto::Expression const> Reference::compile(util::sref<proto::Block>
 
 std::string Reference::typeName() const
 {
-    return "(reference(" + name + "))";
+    return "(reference(" + name.str() + "))";
 }
 
 util::sptr<Expression const> Reference::fold() const
@@ -474,6 +474,12 @@ util::sptr<Expression const> BoolLiteral::fold() const
     return util::mkptr(new BoolLiteral(pos, value));
 }
 
+bool BoolLiteral::appendToLiteralList(std::vector<bool>& values) const
+{
+    values.push_back(value);
+    return true;
+}
+
 util::sptr<Expression const> BoolLiteral::operate(misc::position const& op_pos
                                                 , std::string const& op_img
                                                 , mpz_class const&) const
@@ -541,6 +547,12 @@ util::sptr<Expression const> IntLiteral::fold() const
     return util::mkptr(new IntLiteral(pos, value));
 }
 
+bool IntLiteral::appendToLiteralList(std::vector<platform::int_type>& values) const
+{
+    values.push_back(value.get_si());
+    return true;
+}
+
 util::sptr<Expression const> IntLiteral::operate(misc::position const& op_pos
                                                , std::string const& op_img
                                                , mpz_class const& rhs) const
@@ -606,6 +618,12 @@ util::sptr<Expression const> FloatLiteral::fold() const
     return util::mkptr(new FloatLiteral(pos, value));
 }
 
+bool FloatLiteral::appendToLiteralList(std::vector<platform::float_type>& values) const
+{
+    values.push_back(value.get_d());
+    return true;
+}
+
 util::sptr<Expression const> FloatLiteral::operate(misc::position const& op_pos
                                                  , std::string const& op_img
                                                  , mpz_class const& rhs) const
@@ -683,11 +701,67 @@ static std::vector<util::sptr<Expression const>> foldList(
     return std::move(folded_list);
 }
 
+template <typename _Value>
+static util::sptr<Expression const> literalListOrNul(
+                        misc::position const& pos
+                      , std::vector<util::sptr<Expression const>> const& list)
+{
+    std::vector<_Value> values;
+    values.reserve(list.size());
+    if (!std::all_of(list.begin()
+                   , list.end()
+                   , [&](util::sptr<Expression const> const& member)
+                     {
+                         return member->appendToLiteralList(values);
+                     }))
+    {
+        return util::sptr<Expression const>(nullptr);
+    }
+    return util::mkptr(new LiteralList<_Value>(pos, std::move(values)));
+}
+
 util::sptr<Expression const> ListLiteral::fold() const
 {
-    return util::mkptr(new ListLiteral(pos, foldList(value)));
+    std::vector<util::sptr<Expression const>> folded_list(foldList(value));
+    if (folded_list.empty()) {
+        return util::mkptr(new ListLiteral(pos, std::move(folded_list)));
+    }
+    util::sptr<Expression const> literals(literalListOrNul<platform::int_type>(pos, folded_list));
+    if (literals.nul()) {
+        literals = literalListOrNul<platform::float_type>(pos, folded_list);
+    }
+    if (literals.nul()) {
+        literals = literalListOrNul<bool>(pos, folded_list);
+    }
+    if (literals.nul()) {
+        return util::mkptr(new ListLiteral(pos, std::move(folded_list)));
+    }
+    return std::move(literals);
+}
+
+template <typename _Value>
+util::sptr<proto::Expression const> LiteralList<_Value>::compile(util::sref<proto::Block>
+                                                               , util::sref<SymbolTable>) const
+{
+    return util::mkptr(new proto::LiteralList<_Value>(pos, value));
 }
 
+template <typename _Value>
+std::string LiteralList<_Value>::typeName() const
+{
+    return "list";
+}
+
+template <typename _Value>
+util::sptr<Expression const> LiteralList<_Value>::fold() const
+{
+    return util::mkptr(new LiteralList<_Value>(pos, value));
+}
+
+template struct flchk::LiteralList<platform::int_type>;
+template struct flchk::LiteralList<platform::float_type>;
+template struct flchk::LiteralList<bool>;
+
 util::sptr<proto::Expression const> ListElement::compile(util::sref<proto::Block>
                                                        , util::sref<SymbolTable>) const
 {
@@ -747,7 +821,7 @@ util::sptr<proto::Expression const> Call::compile(util::sref<proto::Block> block
 std::string Call::typeName() const
 {
     if (args.empty()) {
-        return "(call(" + name + "))";
+        return "(call(" + name.str() + "))";
     }
     std::string args_names;
     std::for_each(args.begin()
@@ -756,7 +830,7 @@ std::string Call::typeName() const
                   {
                       args_names += (arg->typeName() + ", ");
                   });
-    return "(call(" + name + ")(" + args_names.substr(0, args_names.length() - 2) + "))";
+    return "(call(" + name.str() + ")(" + args_names.substr(0, args_names.length() - 2) + "))";
 }
 
 util::sptr<Expression const> Call::fold() const
@@ -774,7 +848,7 @@ util::sptr<proto::Expression const> MemberCall::compile(util::sref<proto::Block>
 {
     return util::mkptr(new proto::MemberCall(pos
                                            , object->compile(block, st)
-                                           , call->name
+                                           , call->name.str()
                                            , compileList(call->args, block, st)));
 }
 
@@ -797,7 +871,7 @@ util::sptr<proto::Expression const> FuncReference::compile(util::sref<proto::Blo
 
 std::string FuncReference::typeName() const
 {
-    return "(func reference(" + name + '@' + util::str(param_count) + "))";
+    return "(func reference(" + name.str() + '@' + util::str(param_count) + "))";
 }
 
 util::sptr<Expression const> FuncReference::fold() const
@@ -5,6 +5,7 @@
 #include <vector>
 
 #include <util/pointer.h>
+#include <util/symbol.h>
 
 #include "node-base.h"
 #include "fwd-decl.h"
@@ -121,7 +122,7 @@ namespace flchk {
     struct Reference
         : public Expression
     {
-        Reference(misc::position const& pos, std::string const& n)
+        Reference(misc::position const& pos, util::symbol n)
             : Expression(pos)
             , name(n)
         {}
@@ -131,7 +132,7 @@ namespace flchk {
         std::string typeName() const;
         util::sptr<Expression const> fold() const;
 
-        std::string const name;
+        util::symbol const name;
     };
 
     struct BoolLiteral
@@ -148,6 +149,7 @@ namespace flchk {
         bool boolValue() const;
         std::string typeName() const;
         util::sptr<Expression const> fold() const;
+        bool appendToLiteralList(std::vector<bool>& values) const;
 
         util::sptr<Expression const> operate(misc::position const& op_pos
                                            , std::string const& op_img
@@ -189,6 +191,7 @@ namespace flchk {
         bool boolValue() const;
         std::string typeName() const;
         util::sptr<Expression const> fold() const;
+        bool appendToLiteralList(std::vector<platform::int_type>& values) const;
 
         util::sptr<Expression const> operate(misc::position const& op_pos
                                            , std::string const& op_img
@@ -228,6 +231,7 @@ namespace flchk {
         bool boolValue() const;
         std::string typeName() const;
         util::sptr<Expression const> fold() const;
+        bool appendToLiteralList(std::vector<platform::float_type>& values) const;
 
         util::sptr<Expression const> operate(misc::position const& op_pos
                                            , std::string const& op_img
@@ -264,6 +268,27 @@ namespace flchk {
         std::vector<util::sptr<Expression const>> const value;
     };
 
+    /*
+     * A list literal whose members all folded to literals of one primitive
+     * type keeps only their values, not a node for each of them.
+     */
+    template <typename _Value>
+    struct LiteralList
+        : public Expression
+    {
+        LiteralList(misc::position const& pos, std::vector<_Value> v)
+            : Expression(pos)
+            , value(std::move(v))
+        {}
+
+        util::sptr<proto::Expression const> compile(util::sref<proto::Block>
+                                                  , util::sref<SymbolTable>) const;
+        std::string typeName() const;
+        util::sptr<Expression const> fold() const;
+
+        std::vector<_Value> const value;
+    };
+
     struct ListElement
         : public Expression
     {
@@ -314,7 +339,7 @@ namespace flchk {
         : public Expression
     {
         Call(misc::position const& pos
-           , std::string const& n
+           , util::symbol n
            , std::vector<util::sptr<Expression const>> a)
                 : Expression(pos)
                 , name(n)
@@ -327,7 +352,7 @@ namespace flchk {
         util::sptr<Expression const> fold() const;
         util::sptr<Call const> foldCall() const;
 
-        std::string const name;
+        util::symbol const name;
         std::vector<util::sptr<Expression const>> const args;
     };
 
@@ -354,7 +379,7 @@ namespace flchk {
     struct FuncReference
         : public Expression
     {
-        FuncReference(misc::position const& pos, std::string const& n, int pc)
+        FuncReference(misc::position const& pos, util::symbol n, int pc)
             : Expression(pos)
             , name(n)
             , param_count(pc)
@@ -365,7 +390,7 @@ namespace flchk {
         std::string typeName() const;
         util::sptr<Expression const> fold() const;
 
-        std::string const name;
+        util::symbol const name;
         int const param_count;
     };
 
@@ -5,6 +5,7 @@
 #include <vector>
 
 #include <misc/pos-type.h>
+#include <util/symbol.h>
 
 #include "fwd-decl.h"
 #include "accumulator.h"
@@ -39,11 +40,11 @@ namespace flchk {
                               , util::sptr<Filter> alternative);
     public:
         virtual void defVar(misc::position const& pos
-                          , std::string const& name
+                          , util::symbol name
                           , util::sptr<Expression const> init) = 0;
         virtual void defFunc(misc::position const& pos
-                           , std::string const& name
-                           , std::vector<std::string> const& param_names
+                           , util::symbol name
+                           , std::vector<util::symbol> const& param_names
                            , util::sptr<Filter> body) = 0;
     public:
         virtual util::sref<SymbolTable> getSymbols() = 0;
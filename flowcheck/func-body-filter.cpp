@@ -8,15 +8,15 @@
 using namespace flchk;
 
 void FuncBodyFilter::defVar(misc::position const& pos
-                          , std::string const& name
+                          , util::symbol name
                           , util::sptr<Expression const> init)
 {
     _accumulator.defVar(pos, name, init->fold());
 }
 
 void FuncBodyFilter::defFunc(misc::position const& pos
-                           , std::string const& name
-                           , std::vector<std::string> const& param_names
+                           , util::symbol name
+                           , std::vector<util::symbol> const& param_names
                            , util::sptr<Filter> body)
 {
     _symbols.defFunc(_accumulator.defFunc(pos
@@ -18,7 +18,7 @@ util::sref<proto::Function> Function::compile(util::sref<proto::Block> block)
                 = block->declare(pos, name, param_names, _body->hintReturnVoid());
         std::for_each(param_names.begin()
                     , param_names.end()
-                    , [&](std::string const& param)
+                    , [&](util::symbol param)
                       {
                           _body->getSymbols()->defVar(pos, param);
                       });
@@ -28,7 +28,7 @@ util::sref<proto::Function> Function::compile(util::sref<proto::Block> block)
     return _func_proto_or_nul_if_not_compiled;
 }
 
-std::vector<std::string> Function::freeVariables() const
+std::vector<util::symbol> Function::freeVariables() const
 {
     return _body->getSymbols()->freeVariables();
 }
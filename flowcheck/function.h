@@ -5,6 +5,7 @@
 #include <vector>
 
 #include <util/pointer.h>
+#include <util/symbol.h>
 #include <misc/pos-type.h>
 
 #include "block.h"
@@ -13,8 +14,8 @@ namespace flchk {
 
     struct Function {
         Function(misc::position const& ps
-               , std::string const& func_name
-               , std::vector<std::string> const& params
+               , util::symbol func_name
+               , std::vector<util::symbol> const& params
                , util::sptr<Filter> func_body)
             : pos(ps)
             , name(func_name)
@@ -24,11 +25,11 @@ namespace flchk {
         {}
 
         util::sref<proto::Function> compile(util::sref<proto::Block> block);
-        std::vector<std::string> freeVariables() const;
+        std::vector<util::symbol> freeVariables() const;
 
         misc::position const pos;
-        std::string const name;
-        std::vector<std::string> const param_names;
+        util::symbol const name;
+        std::vector<util::symbol> const param_names;
     private:
         util::sptr<Filter> const _body;
         util::sref<proto::Function> _func_proto_or_nul_if_not_compiled;
@@ -13,6 +13,21 @@ bool Expression::boolValue() const
     return false;
 }
 
+bool Expression::appendToLiteralList(std::vector<platform::int_type>&) const
+{
+    return false;
+}
+
+bool Expression::appendToLiteralList(std::vector<platform::float_type>&) const
+{
+    return false;
+}
+
+bool Expression::appendToLiteralList(std::vector<bool>&) const
+{
+    return false;
+}
+
 util::sptr<Expression const> Expression::operate(misc::position const& op_pos
                                                , std::string const& op_img
                                                , mpz_class const& rhs) const
@@ -6,14 +6,21 @@
 #include <gmpxx.h>
 
 #include <proto/fwd-decl.h>
+#include <util/arena.h>
 #include <util/pointer.h>
 #include <misc/pos-type.h>
+#include <misc/platform.h>
 
 #include "fwd-decl.h"
 
 namespace flchk {
 
-    struct Statement {
+    struct NodeArenaTag;
+    typedef util::arena_allocated<NodeArenaTag> ArenaNode;
+
+    struct Statement
+        : public ArenaNode
+    {
         misc::position const pos;
 
         virtual util::sptr<proto::Statement> compile(util::sref<proto::Block> block
@@ -28,7 +35,9 @@ namespace flchk {
         Statement(Statement const&) = delete;
     };
 
-    struct Expression {
+    struct Expression
+        : public ArenaNode
+    {
         misc::position const pos;
     public:
         virtual util::sptr<proto::Expression const> compile(util::sref<proto::Block> block
@@ -37,6 +46,9 @@ namespace flchk {
         virtual bool isLiteral() const;
         virtual bool boolValue() const;
         virtual util::sptr<Expression const> fold() const = 0;
+        virtual bool appendToLiteralList(std::vector<platform::int_type>& values) const;
+        virtual bool appendToLiteralList(std::vector<platform::float_type>& values) const;
+        virtual bool appendToLiteralList(std::vector<bool>& values) const;
     public:
         virtual util::sptr<Expression const> operate(misc::position const& op_pos
                                                    , std::string const& op_img
@@ -7,6 +7,7 @@
 #include "node-base.h"
 #include "block.h"
 #include <util/pointer.h>
+#include <util/symbol.h>
 
 namespace flchk {
 
@@ -70,7 +71,7 @@ namespace flchk {
     struct VarDef
         : public Statement
     {
-        VarDef(misc::position const& pos, std::string const& n, util::sptr<Expression const> i)
+        VarDef(misc::position const& pos, util::symbol n, util::sptr<Expression const> i)
                 : Statement(pos)
                 , name(n)
                 , init(std::move(i))
@@ -79,7 +80,7 @@ namespace flchk {
         util::sptr<proto::Statement> compile(util::sref<proto::Block> block
                                            , util::sref<SymbolTable> st) const;
 
-        std::string const name;
+        util::symbol const name;
         util::sptr<Expression const> const init;
     };
 
@@ -8,18 +8,18 @@
 using namespace flchk;
 
 void SymbolDefFilter::defVar(misc::position const& pos
-                           , std::string const& name
+                           , util::symbol name
                            , util::sptr<Expression const>)
 {
-    error::forbidDefVar(pos, name);
+    error::forbidDefVar(pos, name.str());
 }
 
 void SymbolDefFilter::defFunc(misc::position const& pos
-                            , std::string const& name
-                            , std::vector<std::string> const&
+                            , util::symbol name
+                            , std::vector<util::symbol> const&
                             , util::sptr<Filter>)
 {
-    error::forbidDefFunc(pos, name);
+    error::forbidDefFunc(pos, name.str());
 }
 
 util::sref<SymbolTable> SymbolDefFilter::getSymbols()
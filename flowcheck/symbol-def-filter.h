@@ -1,6 +1,8 @@
 #ifndef __STEKIN_FLOWCHECK_SYMBOL_DEFINITION_FILTER_H__
 #define __STEKIN_FLOWCHECK_SYMBOL_DEFINITION_FILTER_H__
 
+#include <util/symbol.h>
+
 #include "filter.h"
 
 namespace flchk {
@@ -13,12 +15,12 @@ namespace flchk {
         {}
     public:
         void defVar(misc::position const& pos
-                  , std::string const& name
+                  , util::symbol name
                   , util::sptr<Expression const>);
         util::sref<SymbolTable> getSymbols();
         void defFunc(misc::position const& pos
-                   , std::string const& name
-                   , std::vector<std::string> const&
+                   , util::symbol name
+                   , std::vector<util::symbol> const&
                    , util::sptr<Filter>);
     private:
         util::sref<SymbolTable> const _symbols;
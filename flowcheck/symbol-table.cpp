@@ -38,7 +38,7 @@ std::vector<util::sref<Function>> Overloads::Overload::all() const
     return result_funcs;
 }
 
-std::vector<util::sref<Function>> Overloads::allFuncsOfName(std::string const& name) const
+std::vector<util::sref<Function>> Overloads::allFuncsOfName(util::symbol name) const
 {
     std::vector<util::sref<Function>> external_funcs_of_name(
                                 _external_overloads_or_nul_on_global.not_nul()
@@ -51,7 +51,7 @@ std::vector<util::sref<Function>> Overloads::allFuncsOfName(std::string const& n
     return external_funcs_of_name;
 }
 
-util::sref<Function> Overloads::queryOrNulIfNonexist(std::string const& name, int param_count) const
+util::sref<Function> Overloads::queryOrNulIfNonexist(util::symbol name, int param_count) const
 {
     util::sref<Overload const> o = _overloadByNameOrNulIfNonexist(name);
     if (o.not_nul()) {
@@ -71,55 +71,40 @@ void Overloads::declare(util::sref<Function> func)
     _overloadByName(func->name)->declare(func);
 }
 
-util::sref<Overloads::Overload> Overloads::_overloadByName(std::string const& name)
+util::sref<Overloads::Overload> Overloads::_overloadByName(util::symbol name)
 {
-    auto i = std::find_if(_overloads.begin()
-                        , _overloads.end()
-                        , [&](Overload const& o)
-                          {
-                              return name == o.name;
-                          });
-    if (i != _overloads.end()) {
-        return util::mkref(*i);
-    }
-    _overloads.push_back(Overload(name));
-    return util::mkref(_overloads.back());
+    return util::mkref(_overloads.insert(std::make_pair(name, Overload(name))).first->second);
 }
 
 util::sref<Overloads::Overload const>
-        Overloads::_overloadByNameOrNulIfNonexist(std::string const& name) const
-{
-    auto i = std::find_if(_overloads.begin()
-                        , _overloads.end()
-                        , [&](Overload const& o)
-                          {
-                              return name == o.name;
-                          });
+        Overloads::_overloadByNameOrNulIfNonexist(util::symbol name) const
+{
+    auto i = _overloads.find(name);
     if (i != _overloads.end()) {
-        return util::mkref(*i);
+        return util::mkref(i->second);
     }
     return util::sref<Overload const>(nullptr);
 }
 
-void SymbolTable::refVars(misc::position const& pos, std::vector<std::string> const& vars)
+void SymbolTable::refVars(misc::position const& pos, std::vector<util::symbol> const& vars)
 {
     std::for_each(vars.begin()
                 , vars.end()
-                , [&](std::string const& name)
+                , [&](util::symbol name)
                   {
                       _markReference(pos, name);
                   });
 }
 
-void SymbolTable::defVar(misc::position const& pos, std::string const& name)
+void SymbolTable::defVar(misc::position const& pos, util::symbol name)
 {
     auto local_refs = _external_var_refs.find(name);
     if (_external_var_refs.end() != local_refs) {
-        error::varRefBeforeDef(pos, local_refs->second, name);
+        error::varRefBeforeDef(pos, local_refs->second, name.str());
     }
     auto insert_result = _var_defs.insert(std::make_pair(name, pos));
     if (!insert_result.second) {
-        error::varAlreadyInLocal(insert_result.first->second, pos, name);
+        error::varAlreadyInLocal(insert_result.first->second, pos, name.str());
     }
 }
 
@@ -128,7 +113,10 @@ void SymbolTable::defFunc(util::sref<Function> func)
     util::sref<Function> old_func
             = _overloads.queryOrNulIfNonexist(func->name, func->param_names.size());
     if (old_func.not_nul()) {
-        error::funcAlreadyDef(old_func->pos, func->pos, func->name, func->param_names.size());
+        error::funcAlreadyDef(old_func->pos
+                            , func->pos
+                            , func->name.str()
+                            , func->param_names.size());
         return;
     }
     _overloads.declare(func);
@@ -160,7 +148,7 @@ util::sref<proto::Function> SymbolTable::_compileFunction(misc::position const&
 
 util::sptr<proto::Expression const> SymbolTable::_compileAsFunctor(
                 misc::position const& pos
-              , std::string const& name
+              , util::symbol name
               , util::sref<proto::Block> block
               , std::vector<util::sptr<Expression const>> const& args)
 {
@@ -168,13 +156,13 @@ util::sptr<proto::Expression const> SymbolTable::_compileAsFunctor(
 }
 
 util::sptr<proto::Expression const> SymbolTable::compileRef(misc::position const& pos
-                                                          , std::string const& name
+                                                          , util::symbol name
                                                           , util::sref<proto::Block> block)
 {
     std::vector<util::sref<Function>> funcs = _overloads.allFuncsOfName(name);
     if (!funcs.empty()) {
         if (funcs.size() > 1) {
-            error::funcReferenceAmbiguous(pos, name);
+            error::funcReferenceAmbiguous(pos, name.str());
         }
         return util::mkptr(new proto::FuncReference(pos, _compileFunction(pos, funcs[0], block)));
     }
@@ -185,7 +173,7 @@ util::sptr<proto::Expression const> SymbolTable::compileRef(misc::position const
 util::sptr<proto::Expression const> SymbolTable::compileCall(
                     misc::position const& pos
                   , util::sref<proto::Block> block
-                  , std::string const& name
+                  , util::symbol name
                   , std::vector<util::sptr<Expression const>> const& args)
 {
     util::sref<Function> func = _overloads.queryOrNulIfNonexist(name, args.size());
@@ -198,30 +186,31 @@ util::sptr<proto::Expression const> SymbolTable::compileCall(
 }
 
 util::sref<Function> SymbolTable::queryFunc(misc::position const& pos
-                                          , std::string const& name
+                                          , util::symbol name
                                           , int param_count)
 {
     util::sref<Function> func = _overloads.queryOrNulIfNonexist(name, param_count);
     if (func.not_nul()) {
         return func;
     }
-    error::funcNotDef(pos, name, param_count);
+    error::funcNotDef(pos, name.str(), param_count);
     return util::mkref(_fake_function);
 }
 
-std::vector<std::string> SymbolTable::freeVariables() const
+std::vector<util::symbol> SymbolTable::freeVariables() const
 {
-    std::vector<std::string> result;
+    std::vector<util::symbol> result;
     std::for_each(_external_var_refs.begin()
                 , _external_var_refs.end()
-                , [&](std::pair<std::string, std::list<misc::position>> const& ref)
+                , [&](std::pair<util::symbol const, std::list<misc::position>> const& ref)
                   {
                       result.push_back(ref.first);
                   });
+    std::sort(result.begin(), result.end());
     return result;
 }
 
-void SymbolTable::_markReference(misc::position const& pos, std::string const& name)
+void SymbolTable::_markReference(misc::position const& pos, util::symbol name)
 {
     if (_var_defs.end() == _var_defs.find(name)) {
         _external_var_refs[name].push_back(pos);
@@ -230,5 +219,5 @@ void SymbolTable::_markReference(misc::position const& pos, std::string const& n
 
 Function SymbolTable::_fake_function(misc::position()
                                    , ""
-                                   , std::vector<std::string>()
+                                   , std::vector<util::symbol>()
                                    , util::mkptr(new GlobalFilter));
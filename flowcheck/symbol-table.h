@@ -3,11 +3,13 @@
 
 #include <string>
 #include <map>
+#include <unordered_map>
 #include <list>
 #include <vector>
 
 #include <proto/fwd-decl.h>
 #include <util/pointer.h>
+#include <util/symbol.h>
 #include <misc/pos-type.h>
 
 #include "fwd-decl.h"
@@ -20,11 +22,11 @@ namespace flchk {
         {}
     private:
         struct Overload {
-            explicit Overload(std::string const& n)
+            explicit Overload(util::symbol n)
                 : name(n)
             {}
 
-            std::string const name;
+            util::symbol const name;
         public:
             util::sref<Function> queryOrNulIfNonexist(int param_count) const;
             void declare(util::sref<Function> func);
@@ -33,15 +35,15 @@ namespace flchk {
             std::map<int, util::sref<Function> const> _funcs;
         };
     public:
-        std::vector<util::sref<Function>> allFuncsOfName(std::string const& name) const;
-        util::sref<Function> queryOrNulIfNonexist(std::string const& name, int param_count) const;
+        std::vector<util::sref<Function>> allFuncsOfName(util::symbol name) const;
+        util::sref<Function> queryOrNulIfNonexist(util::symbol name, int param_count) const;
         void declare(util::sref<Function> func);
     private:
-        util::sref<Overload> _overloadByName(std::string const& name);
-        util::sref<Overload const> _overloadByNameOrNulIfNonexist(std::string const& name) const;
+        util::sref<Overload> _overloadByName(util::symbol name);
+        util::sref<Overload const> _overloadByNameOrNulIfNonexist(util::symbol name) const;
     private:
         util::sref<Overloads const> const _external_overloads_or_nul_on_global;
-        std::list<Overload> _overloads;
+        std::unordered_map<util::symbol, Overload> _overloads;
     };
 
     struct SymbolTable {
@@ -59,24 +61,24 @@ namespace flchk {
             , _overloads(rhs._overloads)
         {}
 
-        void refVars(misc::position const& pos, std::vector<std::string> const& vars);
-        void defVar(misc::position const& pos, std::string const& name);
+        void refVars(misc::position const& pos, std::vector<util::symbol> const& vars);
+        void defVar(misc::position const& pos, util::symbol name);
         void defFunc(util::sref<Function> func);
 
         util::sptr<proto::Expression const> compileRef(misc::position const& pos
-                                                     , std::string const& name
+                                                     , util::symbol name
                                                      , util::sref<proto::Block> block);
         util::sptr<proto::Expression const> compileCall(
                         misc::position const& pos
                       , util::sref<proto::Block> block
-                      , std::string const& name
+                      , util::symbol name
                       , std::vector<util::sptr<Expression const>> const& args);
         util::sref<Function> queryFunc(misc::position const& pos
-                                     , std::string const& name
+                                     , util::symbol name
                                      , int param_count);
-        std::vector<std::string> freeVariables() const;
+        std::vector<util::symbol> freeVariables() const; /* ordered by name */
     private:
-        void _markReference(misc::position const& pos, std::string const& name);
+        void _markReference(misc::position const& pos, util::symbol name);
         std::vector<util::sptr<proto::Expression const>> _mkArgs(
                         std::vector<util::sptr<Expression const>> const& args
                       , util::sref<proto::Block> block);
@@ -85,12 +87,12 @@ namespace flchk {
                                                    , util::sref<proto::Block> block);
         util::sptr<proto::Expression const> _compileAsFunctor(
                         misc::position const& pos
-                      , std::string const& name
+                      , util::symbol name
                       , util::sref<proto::Block> block
                       , std::vector<util::sptr<Expression const>> const& args);
     private:
-        std::map<std::string, std::list<misc::position>> _external_var_refs;
-        std::map<std::string, misc::position> _var_defs;
+        std::unordered_map<util::symbol, std::list<misc::position>> _external_var_refs;
+        std::unordered_map<util::symbol, misc::position> _var_defs;
 
         Overloads _overloads;
     private:
@@ -48,16 +48,16 @@ std::vector<util::sptr<inst::Function const>> Block::deliverFuncs()
 }
 
 util::sref<Function> Block::declare(misc::position const& pos
-                                  , std::string const& name
-                                  , std::vector<std::string> const& param_names
+                                  , util::symbol name
+                                  , std::vector<util::symbol> const& param_names
                                   , bool hint_return_void)
 {
-    DataTree::actualOne()(pos, FUNC_DECL, name, param_names.size(), hint_return_void);
+    DataTree::actualOne()(pos, FUNC_DECL, name.str(), param_names.size(), hint_return_void);
     std::for_each(param_names.begin()
                 , param_names.end()
-                , [&](std::string const& param)
+                , [&](util::symbol param)
                   {
-                      DataTree::actualOne()(pos, PARAMETER, param);
+                      DataTree::actualOne()(pos, PARAMETER, param.str());
                   });
     func_entities.push_back(util::mkptr(new Function(pos, name, param_names, hint_return_void)));
     return *func_entities.back();
@@ -92,7 +92,7 @@ util::sptr<inst::Statement const> ReturnNothing::_inst(util::sref<FuncInstDraft>
 
 util::sptr<inst::Statement const> VarDef::_inst(util::sref<FuncInstDraft>, misc::trace&) const
 {
-    DataTree::actualOne()(pos, VAR_DEF, name);
+    DataTree::actualOne()(pos, VAR_DEF, name.str());
     init->inst(nul_st, nultrace);
     return std::move(NUL_INST_STMT);
 }
@@ -160,6 +160,14 @@ util::sptr<inst::Expression const> ListLiteral::inst(util::sref<SymbolTable cons
     return std::move(NUL_INST_EXPR);
 }
 
+template <typename _Value>
+util::sptr<inst::Expression const> LiteralList<_Value>::inst(util::sref<SymbolTable const>
+                                                           , misc::trace&) const
+{
+    DataTree::actualOne()(pos, LITERAL_LIST, value.size());
+    return std::move(NUL_INST_EXPR);
+}
+
 util::sptr<inst::Expression const> ListElement::inst(util::sref<SymbolTable const>
                                                    , misc::trace&) const
 {
@@ -186,14 +194,14 @@ util::sptr<inst::Expression const> ListAppend::inst(util::sref<SymbolTable const
 util::sptr<inst::Expression const> Reference::inst(util::sref<SymbolTable const>
                                                  , misc::trace&) const
 {
-    DataTree::actualOne()(pos, REFERENCE, name);
+    DataTree::actualOne()(pos, REFERENCE, name.str());
     return std::move(NUL_INST_EXPR);
 }
 
 util::sptr<inst::Expression const> Call::inst(util::sref<SymbolTable const>
                                             , misc::trace&) const
 {
-    DataTree::actualOne()(pos, CALL, _func->name, _args.size(), false);
+    DataTree::actualOne()(pos, CALL, _func->name.str(), _args.size(), false);
     instList(_args);
     return std::move(NUL_INST_EXPR);
 }
@@ -211,14 +219,14 @@ util::sptr<inst::Expression const> MemberCall::inst(util::sref<SymbolTable const
 util::sptr<inst::Expression const> FuncReference::inst(util::sref<SymbolTable const>
                                                      , misc::trace&) const
 {
-    DataTree::actualOne()(pos, FUNC_REFERENCE, _func->name, _func->param_names.size(), false);
+    DataTree::actualOne()(pos, FUNC_REFERENCE, _func->name.str(), _func->param_names.size(), false);
     return std::move(NUL_INST_EXPR);
 }
 
 util::sptr<inst::Expression const> Functor::inst(util::sref<SymbolTable const>
                                                , misc::trace&) const
 {
-    DataTree::actualOne()(pos, FUNCTOR, name, _args.size(), false);
+    DataTree::actualOne()(pos, FUNCTOR, name.str(), _args.size(), false);
     std::for_each(_args.begin()
                 , _args.end()
                 , [&](util::sptr<Expression const> const& arg)
@@ -228,6 +236,16 @@ util::sptr<inst::Expression const> Functor::inst(util::sref<SymbolTable const>
     return std::move(NUL_INST_EXPR);
 }
 
+int Operation::binaryOpId(std::string const&)
+{
+    return 0;
+}
+
+int Operation::preUnaryOpId(std::string const&)
+{
+    return 0;
+}
+
 util::sptr<inst::Expression const> BinaryOp::inst(util::sref<SymbolTable const>
                                                 , misc::trace&) const
 {
@@ -314,7 +332,7 @@ util::sref<Block> Function::block()
     return util::mkref(_block);
 }
 
-void Function::setFreeVariables(std::vector<std::string> const&) {}
+void Function::setFreeVariables(std::vector<util::symbol> const&) {}
 
 util::sref<Type const> BoolLiteral::type(util::sref<SymbolTable const>, misc::trace&) const
 {
@@ -336,6 +354,12 @@ util::sref<Type const> ListLiteral::type(util::sref<SymbolTable const>, misc::tr
     return NUL_TYPE;
 }
 
+template <typename _Value>
+util::sref<Type const> LiteralList<_Value>::type(util::sref<SymbolTable const>, misc::trace&) const
+{
+    return NUL_TYPE;
+}
+
 util::sref<Type const> ListElement::type(util::sref<SymbolTable const>, misc::trace&) const
 {
     return NUL_TYPE;
@@ -493,6 +517,19 @@ util::sptr<inst::Expression const> ListLiteral::instAsPipe(util::sref<SymbolTabl
     return inst(st, trace);
 }
 
+template <typename _Value>
+util::sptr<inst::Expression const> LiteralList<_Value>::instAsPipe(
+                                                            util::sref<SymbolTable const> st
+                                                          , util::sref<ListContext const>
+                                                          , misc::trace& trace) const
+{
+    return inst(st, trace);
+}
+
+template struct proto::LiteralList<platform::int_type>;
+template struct proto::LiteralList<platform::float_type>;
+template struct proto::LiteralList<bool>;
+
 util::sref<Type const> ListElement::typeAsPipe(util::sref<SymbolTable const> st
                                              , util::sref<ListContext const>
                                              , misc::trace& trace) const
@@ -639,3 +676,289 @@ util::sptr<inst::Expression const> ListPipeline::instAsPipe(util::sref<SymbolTab
 {
     return inst(st, trace);
 }
+
+bool Expression::isListIndex() const
+{
+    return false;
+}
+
+bool Expression::isPipeInvariant() const
+{
+    return false;
+}
+
+bool Expression::indexBounds(util::sref<SymbolTable const>
+                           , misc::trace&
+                           , std::vector<util::sptr<inst::SliceBound const>>&) const
+{
+    return false;
+}
+
+bool BoolLiteral::isPipeInvariant() const
+{
+    return true;
+}
+
+bool IntLiteral::isPipeInvariant() const
+{
+    return true;
+}
+
+bool FloatLiteral::isPipeInvariant() const
+{
+    return true;
+}
+
+bool ListIndex::isListIndex() const
+{
+    return true;
+}
+
+bool Reference::isPipeInvariant() const
+{
+    return true;
+}
+
+bool BinaryOp::isPipeInvariant() const
+{
+    return false;
+}
+
+bool BinaryOp::indexBounds(util::sref<SymbolTable const>
+                         , misc::trace&
+                         , std::vector<util::sptr<inst::SliceBound const>>&) const
+{
+    return false;
+}
+
+bool PreUnaryOp::isPipeInvariant() const
+{
+    return false;
+}
+
+bool Conjunction::indexBounds(util::sref<SymbolTable const>
+                            , misc::trace&
+                            , std::vector<util::sptr<inst::SliceBound const>>&) const
+{
+    return false;
+}
+
+bool PipeMap::indexBounds(util::sref<SymbolTable const>
+                        , misc::trace&
+                        , std::vector<util::sptr<inst::SliceBound const>>&) const
+{
+    return false;
+}
+
+bool PipeFilter::indexBounds(util::sref<SymbolTable const>
+                           , misc::trace&
+                           , std::vector<util::sptr<inst::SliceBound const>>&) const
+{
+    return false;
+}
+
+util::sptr<inst::Expression const> Expression::instAsKernel(util::sref<SymbolTable const>
+                                                  , util::sref<Type const>
+                                                  , std::vector<util::sptr<inst::Expression const>>&
+                                                  , misc::trace&) const
+{
+    return util::sptr<inst::Expression const>(nullptr);
+}
+
+util::sptr<inst::Expression const> ListElement::instAsKernel(util::sref<SymbolTable const>
+                                                  , util::sref<Type const>
+                                                  , std::vector<util::sptr<inst::Expression const>>&
+                                                  , misc::trace&) const
+{
+    return util::sptr<inst::Expression const>(nullptr);
+}
+
+util::sptr<inst::Expression const> ListIndex::instAsKernel(util::sref<SymbolTable const>
+                                                  , util::sref<Type const>
+                                                  , std::vector<util::sptr<inst::Expression const>>&
+                                                  , misc::trace&) const
+{
+    return util::sptr<inst::Expression const>(nullptr);
+}
+
+util::sptr<inst::Expression const> BinaryOp::instAsKernel(util::sref<SymbolTable const>
+                                                  , util::sref<Type const>
+                                                  , std::vector<util::sptr<inst::Expression const>>&
+                                                  , misc::trace&) const
+{
+    return util::sptr<inst::Expression const>(nullptr);
+}
+
+util::sptr<inst::Expression const> PreUnaryOp::instAsKernel(util::sref<SymbolTable const>
+                                                  , util::sref<Type const>
+                                                  , std::vector<util::sptr<inst::Expression const>>&
+                                                  , misc::trace&) const
+{
+    return util::sptr<inst::Expression const>(nullptr);
+}
+
+util::sptr<inst::Expression const> PipeMap::instAsKernel(util::sref<SymbolTable const>
+                                                  , util::sref<Type const>
+                                                  , std::vector<util::sptr<inst::Expression const>>&
+                                                  , misc::trace&) const
+{
+    return util::sptr<inst::Expression const>(nullptr);
+}
+
+util::sptr<inst::Expression const> PipeFilter::instAsKernel(util::sref<SymbolTable const>
+                                                  , util::sref<Type const>
+                                                  , std::vector<util::sptr<inst::Expression const>>&
+                                                  , misc::trace&) const
+{
+    return util::sptr<inst::Expression const>(nullptr);
+}
+
+bool Expression::isElementwise() const
+{
+    return false;
+}
+
+bool BoolLiteral::isElementwise() const
+{
+    return false;
+}
+
+bool IntLiteral::isElementwise() const
+{
+    return false;
+}
+
+bool FloatLiteral::isElementwise() const
+{
+    return false;
+}
+
+bool ListElement::isElementwise() const
+{
+    return false;
+}
+
+bool ListIndex::isElementwise() const
+{
+    return false;
+}
+
+bool Reference::isElementwise() const
+{
+    return false;
+}
+
+bool BinaryOp::isElementwise() const
+{
+    return false;
+}
+
+bool PreUnaryOp::isElementwise() const
+{
+    return false;
+}
+
+bool Conjunction::isElementwise() const
+{
+    return false;
+}
+
+bool Disjunction::isElementwise() const
+{
+    return false;
+}
+
+bool Negation::isElementwise() const
+{
+    return false;
+}
+
+bool Expression::usesListIndex() const
+{
+    return false;
+}
+
+bool Expression::mayTrap() const
+{
+    return false;
+}
+
+bool BinaryOp::mayTrap() const
+{
+    return false;
+}
+
+bool PreUnaryOp::mayTrap() const
+{
+    return false;
+}
+
+bool ListIndex::usesListIndex() const
+{
+    return false;
+}
+
+bool BinaryOp::usesListIndex() const
+{
+    return false;
+}
+
+bool PreUnaryOp::usesListIndex() const
+{
+    return false;
+}
+
+bool Conjunction::usesListIndex() const
+{
+    return false;
+}
+
+bool Disjunction::usesListIndex() const
+{
+    return false;
+}
+
+bool Negation::usesListIndex() const
+{
+    return false;
+}
+
+bool ListLiteral::usesListIndex() const
+{
+    return false;
+}
+
+bool Call::usesListIndex() const
+{
+    return false;
+}
+
+bool MemberCall::usesListIndex() const
+{
+    return false;
+}
+
+bool Functor::usesListIndex() const
+{
+    return false;
+}
+
+bool ListAppend::usesListIndex() const
+{
+    return false;
+}
+
+bool ListPipeline::usesListIndex() const
+{
+    return false;
+}
+
+bool PipeMap::isElementwise(bool&) const
+{
+    return false;
+}
+
+bool PipeFilter::isElementwise(bool&) const
+{
+    return false;
+}
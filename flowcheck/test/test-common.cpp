@@ -67,6 +67,7 @@ NodeType const test::BOOLEAN("boolean");
 NodeType const test::INTEGER("integer");
 NodeType const test::FLOATING("floating");
 NodeType const test::LIST("list");
+NodeType const test::LITERAL_LIST("literal list");
 NodeType const test::BINARY_OP("binary operation");
 NodeType const test::PRE_UNARY_OP("prefix unary operation");
 NodeType const test::CALL("call");
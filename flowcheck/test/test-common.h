@@ -75,6 +75,7 @@ namespace test {
     extern NodeType const INTEGER;
     extern NodeType const FLOATING;
     extern NodeType const LIST;
+    extern NodeType const LITERAL_LIST;
     extern NodeType const BINARY_OP;
     extern NodeType const PRE_UNARY_OP;
     extern NodeType const CALL;
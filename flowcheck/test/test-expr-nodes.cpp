@@ -87,6 +87,35 @@ TEST_F(ExprNodesTest, ListLiterals)
     ;
 }
 
+TEST_F(ExprNodesTest, LiteralListFolding)
+{
+    misc::position pos(2);
+    util::sptr<proto::Block> block(new proto::Block);
+    flchk::SymbolTable st;
+
+    std::vector<util::sptr<flchk::Expression const>> members;
+    members.push_back(util::mkptr(new flchk::IntLiteral(pos, "1123")));
+    members.push_back(util::mkptr(new flchk::PreUnaryOp(
+                            pos, "-", util::mkptr(new flchk::IntLiteral(pos, "58")))));
+    members.push_back(util::mkptr(new flchk::IntLiteral(pos, "13")));
+    flchk::ListLiteral(pos, std::move(members)).fold()->compile(*block, util::mkref(st))
+                                                      ->inst(nul_st, nultrace);
+
+    members.push_back(util::mkptr(new flchk::IntLiteral(pos, "21")));
+    members.push_back(util::mkptr(new flchk::FloatLiteral(pos, "34.55")));
+    flchk::ListLiteral(pos, std::move(members)).fold()->compile(*block, util::mkref(st))
+                                                      ->inst(nul_st, nultrace);
+
+    EXPECT_FALSE(error::hasError());
+
+    DataTree::expectOne()
+        (pos, LITERAL_LIST, 3)
+        (pos, LIST, 2)
+            (pos, INTEGER, "21")
+            (pos, FLOATING, "34.55")
+    ;
+}
+
 TEST_F(ExprNodesTest, Reference)
 {
     misc::position pos(3);
@@ -193,7 +222,7 @@ TEST_F(ExprNodesTest, Calls)
     misc::position pos_d(300);
     util::sptr<proto::Block> block(new proto::Block);
     flchk::GlobalFilter filter;
-    filter.defFunc(pos_d, "fib", std::vector<std::string>(), util::mkptr(
+    filter.defFunc(pos_d, "fib", std::vector<util::symbol>(), util::mkptr(
                                                 new flchk::FuncBodyFilter(filter.getSymbols())));
 
     std::vector<util::sptr<flchk::Expression const>> params;
@@ -234,9 +263,9 @@ TEST_F(ExprNodesTest, FuncReference)
     util::sptr<proto::Block> block(new proto::Block);
     flchk::GlobalFilter filter;
     misc::position pos_d(400);
-    filter.defFunc(pos_d, "fib", std::vector<std::string>(), util::mkptr(
+    filter.defFunc(pos_d, "fib", std::vector<util::symbol>(), util::mkptr(
                                                 new flchk::FuncBodyFilter(filter.getSymbols())));
-    filter.defFunc(pos_d, "fib", std::vector<std::string>({ "x" }), util::mkptr(
+    filter.defFunc(pos_d, "fib", std::vector<util::symbol>({ "x" }), util::mkptr(
                                                 new flchk::FuncBodyFilter(filter.getSymbols())));
 
     flchk::FuncReference func_ref0(pos, "fib", 0);
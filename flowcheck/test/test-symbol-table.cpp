@@ -192,7 +192,7 @@ TEST_F(SymbolTableTest, FuncDefRef)
 {
     misc::position pos(8);
     misc::position ref_pos(400);
-    std::vector<std::string> params;
+    std::vector<util::symbol> params;
     util::sref<flchk::Function> func(nullptr);
 
     params = { "m", "n" };
@@ -208,19 +208,19 @@ TEST_F(SymbolTableTest, FuncDefRef)
     ASSERT_FALSE(error::hasError());
     ASSERT_EQ(pos, func->pos);
     ASSERT_EQ("fa", func->name);
-    ASSERT_TRUE(std::vector<std::string>({ "m", "n" }) == func->param_names);
+    ASSERT_TRUE(std::vector<util::symbol>({ "m", "n" }) == func->param_names);
 
     func = symbols->queryFunc(ref_pos, "fa", 3);
     ASSERT_FALSE(error::hasError());
     ASSERT_EQ(pos, func->pos);
     ASSERT_EQ("fa", func->name);
-    ASSERT_TRUE(std::vector<std::string>({ "x", "y", "z" }) == func->param_names);
+    ASSERT_TRUE(std::vector<util::symbol>({ "x", "y", "z" }) == func->param_names);
 
     func = symbols->queryFunc(ref_pos, "fb", 3);
     ASSERT_FALSE(error::hasError());
     ASSERT_EQ(pos, func->pos);
     ASSERT_EQ("fb", func->name);
-    ASSERT_TRUE(std::vector<std::string>({ "x", "y", "z" }) == func->param_names);
+    ASSERT_TRUE(std::vector<util::symbol>({ "x", "y", "z" }) == func->param_names);
 
     flchk::SymbolTable inner_symbols(refSym());
     params = { "a", "b" };
@@ -232,25 +232,25 @@ TEST_F(SymbolTableTest, FuncDefRef)
     ASSERT_FALSE(error::hasError());
     ASSERT_EQ(pos, func->pos);
     ASSERT_EQ("fa", func->name);
-    ASSERT_TRUE(std::vector<std::string>({ "m", "n" }) == func->param_names);
+    ASSERT_TRUE(std::vector<util::symbol>({ "m", "n" }) == func->param_names);
 
     func = inner_symbols.queryFunc(ref_pos, "fb", 2);
     ASSERT_FALSE(error::hasError());
     ASSERT_EQ(pos, func->pos);
     ASSERT_EQ("fb", func->name);
-    ASSERT_TRUE(std::vector<std::string>({ "a", "b" }) == func->param_names);
+    ASSERT_TRUE(std::vector<util::symbol>({ "a", "b" }) == func->param_names);
 
     func = inner_symbols.queryFunc(ref_pos, "fa", 3);
     ASSERT_FALSE(error::hasError());
     ASSERT_EQ(pos, func->pos);
     ASSERT_EQ("fa", func->name);
-    ASSERT_TRUE(std::vector<std::string>({ "x", "y", "z" }) == func->param_names);
+    ASSERT_TRUE(std::vector<util::symbol>({ "x", "y", "z" }) == func->param_names);
 
     func = inner_symbols.queryFunc(ref_pos, "fb", 3);
     ASSERT_FALSE(error::hasError());
     ASSERT_EQ(pos, func->pos);
     ASSERT_EQ("fb", func->name);
-    ASSERT_TRUE(std::vector<std::string>({ "x", "y", "z" }) == func->param_names);
+    ASSERT_TRUE(std::vector<util::symbol>({ "x", "y", "z" }) == func->param_names);
 }
 
 TEST_F(SymbolTableTest, RedefFunc)
@@ -258,7 +258,7 @@ TEST_F(SymbolTableTest, RedefFunc)
     misc::position pos(9);
     misc::position err_pos0(500);
     misc::position err_pos1(501);
-    std::vector<std::string> params;
+    std::vector<util::symbol> params;
 
     params = { "m", "n" };
     flchk::Function f0a(pos, "f0", params, mkBody());
@@ -302,7 +302,7 @@ TEST_F(SymbolTableTest, NondefFunc)
     misc::position err_pos0(600);
     misc::position err_pos1(601);
     std::vector<FuncNondefRec> func_nondefs;
-    std::vector<std::string> params;
+    std::vector<util::symbol> params;
 
     params = { "m", "n" };
     flchk::Function f0(pos, "f0", params, mkBody());
@@ -337,14 +337,14 @@ TEST_F(SymbolTableTest, FuncRefAmbiguous)
     misc::position pos(12);
     misc::position err_pos0(1200);
     misc::position err_pos1(1201);
-    std::vector<std::string> params;
+    std::vector<util::symbol> params;
     params = { "nakamura" };
     flchk::Function ga(pos, "guild", params, mkBody());
     symbols->defFunc(util::mkref(ga));
-    flchk::Function gb(pos, "guild", std::vector<std::string>(), mkBody());
+    flchk::Function gb(pos, "guild", std::vector<util::symbol>(), mkBody());
     symbols->defFunc(util::mkref(gb));
 
-    flchk::Function gdma(pos, "girl_dead_monster", std::vector<std::string>(), mkBody());
+    flchk::Function gdma(pos, "girl_dead_monster", std::vector<util::symbol>(), mkBody());
     symbols->defFunc(util::mkref(gdma));
     flchk::SymbolTable inner_symbols(refSym());
     params = { "yui", "iwasawa", "sekine" };
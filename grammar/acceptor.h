@@ -2,6 +2,7 @@
 #define __STEKIN_GRAMMAR_ACCEPTOR_H__
 
 #include <util/pointer.h>
+#include <util/symbol.h>
 #include <misc/pos-type.h>
 
 #include "node-base.h"
@@ -78,15 +79,15 @@ namespace grammar {
         void deliverTo(util::sref<Acceptor> acc);
 
         FunctionAcceptor(misc::position const& pos
-                       , std::string const& func_name
-                       , std::vector<std::string> const& params)
+                       , util::symbol func_name
+                       , std::vector<util::symbol> const& params)
             : Acceptor(pos)
             , name(func_name)
             , param_names(params)
         {}
 
-        std::string const name;
-        std::vector<std::string> const param_names;
+        util::symbol const name;
+        std::vector<util::symbol> const param_names;
     private:
         Block _body;
     };
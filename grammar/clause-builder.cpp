@@ -113,7 +113,7 @@ void ClauseBuilder::addArith(int indent_len, util::sptr<Expression const> arith)
 }
 
 void ClauseBuilder::addVarDef(int indent_len
-                            , std::string const& name
+                            , util::symbol name
                             , util::sptr<Expression const> init)
 {
     misc::position pos(init->pos);
@@ -133,8 +133,8 @@ void ClauseBuilder::addReturnNothing(int indent_len, misc::position const& pos)
 
 void ClauseBuilder::addFunction(int indent_len
                               , misc::position const& pos
-                              , std::string const& name
-                              , std::vector<std::string> const& params)
+                              , util::symbol name
+                              , std::vector<util::symbol> const& params)
 {
     _stack.add(indent_len, std::move(util::mkptr(new FunctionAcceptor(pos, name, params))));
 }
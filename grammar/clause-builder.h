@@ -6,6 +6,7 @@
 #include <string>
 
 #include <util/pointer.h>
+#include <util/symbol.h>
 #include <misc/pos-type.h>
 
 #include "acceptor.h"
@@ -54,14 +55,14 @@ namespace grammar {
 
     struct ClauseBuilder {
         void addArith(int indent_len, util::sptr<Expression const> arith);
-        void addVarDef(int indent_len, std::string const& name, util::sptr<Expression const> init);
+        void addVarDef(int indent_len, util::symbol name, util::sptr<Expression const> init);
         void addReturn(int indent_len, util::sptr<Expression const> ret_val);
         void addReturnNothing(int indent_len, misc::position const& pos);
 
         void addFunction(int indent_len
                        , misc::position const& pos
-                       , std::string const& name
-                       , std::vector<std::string> const& params);
+                       , util::symbol name
+                       , std::vector<util::symbol> const& params);
         void addIf(int indent_len, util::sptr<Expression const> condition);
         void addIfnot(int indent_len, util::sptr<Expression const> condition);
         void addElse(int indent_len, misc::position const& pos);
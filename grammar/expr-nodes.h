@@ -3,6 +3,8 @@
 
 #include <vector>
 
+#include <util/symbol.h>
+
 #include "node-base.h"
 
 namespace grammar {
@@ -92,14 +94,14 @@ namespace grammar {
     struct Reference
         : public Expression
     {
-        Reference(misc::position const& pos, std::string const& n)
+        Reference(misc::position const& pos, util::symbol n)
             : Expression(pos)
             , name(n)
         {}
 
         util::sptr<flchk::Expression const> compile() const;
 
-        std::string const name;
+        util::symbol const name;
     };
 
     struct BoolLiteral
@@ -195,7 +197,7 @@ namespace grammar {
         : public Expression
     {
         Call(misc::position const& pos
-           , std::string const& n
+           , util::symbol n
            , std::vector<util::sptr<Expression const>> a)
                 : Expression(pos)
                 , name(n)
@@ -205,7 +207,7 @@ namespace grammar {
         util::sptr<flchk::Expression const> compile() const;
         util::sptr<flchk::Call const> cplMemberCall() const;
 
-        std::string const name;
+        util::symbol const name;
         std::vector<util::sptr<Expression const>> const args;
     };
 
@@ -229,7 +231,7 @@ namespace grammar {
     struct FuncReference
         : public Expression
     {
-        FuncReference(misc::position const& pos, std::string const& n, int pc)
+        FuncReference(misc::position const& pos, util::symbol n, int pc)
             : Expression(pos)
             , name(n)
             , param_count(pc)
@@ -237,7 +239,7 @@ namespace grammar {
 
         util::sptr<flchk::Expression const> compile() const;
 
-        std::string const name;
+        util::symbol const name;
         int const param_count;
     };
 
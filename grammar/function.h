@@ -6,6 +6,7 @@
 
 #include <flowcheck/fwd-decl.h>
 #include <util/pointer.h>
+#include <util/symbol.h>
 #include <misc/pos-type.h>
 
 #include "block.h"
@@ -14,8 +15,8 @@ namespace grammar {
 
     struct Function {
         Function(misc::position const& ps
-               , std::string const& n
-               , std::vector<std::string> const& params
+               , util::symbol n
+               , std::vector<util::symbol> const& params
                , Block b)
             : pos(ps)
             , name(n)
@@ -26,8 +27,8 @@ namespace grammar {
         void compile(util::sref<flchk::Filter> filter) const;
 
         misc::position const pos;
-        std::string const name;
-        std::vector<std::string> const param_names;
+        util::symbol const name;
+        std::vector<util::symbol> const param_names;
         Block const body;
     };
 
@@ -2,12 +2,18 @@
 #define __STEKIN_GRAMMAR_NODE_BASE_H__
 
 #include <flowcheck/fwd-decl.h>
+#include <util/arena.h>
 #include <util/pointer.h>
 #include <misc/pos-type.h>
 
 namespace grammar {
 
-    struct Statement {
+    struct NodeArenaTag;
+    typedef util::arena_allocated<NodeArenaTag> ArenaNode;
+
+    struct Statement
+        : public ArenaNode
+    {
         misc::position const pos;
 
         virtual void compile(util::sref<flchk::Filter> filter) const = 0;
@@ -21,7 +27,9 @@ namespace grammar {
         Statement(Statement const&) = delete;
     };
 
-    struct Expression {
+    struct Expression
+        : public ArenaNode
+    {
         misc::position const pos;
 
         virtual util::sptr<flchk::Expression const> compile() const = 0;
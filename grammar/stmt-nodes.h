@@ -5,6 +5,7 @@
 #include <list>
 
 #include <util/pointer.h>
+#include <util/symbol.h>
 
 #include "node-base.h"
 #include "block.h"
@@ -97,7 +98,7 @@ namespace grammar {
     struct VarDef
         : public Statement
     {
-        VarDef(misc::position const& pos, std::string const& n, util::sptr<Expression const> i)
+        VarDef(misc::position const& pos, util::symbol n, util::sptr<Expression const> i)
             : Statement(pos)
             , name(n)
             , init(std::move(i))
@@ -105,7 +106,7 @@ namespace grammar {
 
         void compile(util::sref<flchk::Filter> filter) const;
 
-        std::string const name;
+        util::symbol const name;
         util::sptr<Expression const> const init;
     };
 
@@ -84,12 +84,12 @@ namespace {
 
 util::sref<proto::Function> Function::compile(util::sref<proto::Block>)
 {
-    DataTree::actualOne()(pos, FUNC_DEF, name);
+    DataTree::actualOne()(pos, FUNC_DEF, name.str());
     std::for_each(param_names.begin()
                 , param_names.end()
-                , [&](std::string const& param)
+                , [&](util::symbol param)
                   {
-                      DataTree::actualOne()(pos, PARAMETER, param);
+                      DataTree::actualOne()(pos, PARAMETER, param.str());
                   });
     _body->compile(nulblock);
     return util::sref<proto::Function>(nullptr);
@@ -101,8 +101,8 @@ void Block::addStmt(util::sptr<Statement const> stmt)
 }
 
 util::sref<Function> Block::defFunc(misc::position const& pos
-                                  , std::string const& name
-                                  , std::vector<std::string> const& param_names
+                                  , util::symbol name
+                                  , std::vector<util::symbol> const& param_names
                                   , util::sptr<Filter> body)
 {
     _funcs.push_back(util::mkptr(new Function(pos, name, param_names, std::move(body))));
@@ -173,15 +173,15 @@ void Accumulator::addBranchAlterOnly(misc::position const& pos
 }
 
 void Accumulator::defVar(misc::position const& pos
-                       , std::string const& name
+                       , util::symbol name
                        , util::sptr<Expression const> init)
 {
     _block.addStmt(util::mkptr(new VarDef(pos, name, std::move(init))));
 }
 
 util::sref<Function> Accumulator::defFunc(misc::position const& pos
-                                        , std::string const& name
-                                        , std::vector<std::string> const& param_names
+                                        , util::symbol name
+                                        , std::vector<util::symbol> const& param_names
                                         , util::sptr<Filter> body)
 {
     return _block.defFunc(pos, name, param_names, std::move(body));
@@ -240,15 +240,15 @@ void Filter::compile(util::sref<proto::Block> block)
 }
 
 void FuncBodyFilter::defVar(misc::position const& pos
-                          , std::string const& name
+                          , util::symbol name
                           , util::sptr<Expression const> init)
 {
     _accumulator.defVar(pos, name, std::move(init));
 }
 
 void FuncBodyFilter::defFunc(misc::position const& pos
-                           , std::string const& name
-                           , std::vector<std::string> const& param_names
+                           , util::symbol name
+                           , std::vector<util::symbol> const& param_names
                            , util::sptr<Filter> body)
 {
     _accumulator.defFunc(pos, name, param_names, std::move(body));
@@ -260,18 +260,18 @@ util::sref<SymbolTable> FuncBodyFilter::getSymbols()
 }
 
 void SymbolDefFilter::defVar(misc::position const& pos
-                           , std::string const& name
+                           , util::symbol name
                            , util::sptr<Expression const> init)
 {
-    _accumulator.defVar(pos, name + VAR_DEF_FILTERED, std::move(init));
+    _accumulator.defVar(pos, name.str() + VAR_DEF_FILTERED, std::move(init));
 }
 
 void SymbolDefFilter::defFunc(misc::position const& pos
-                            , std::string const& name
-                            , std::vector<std::string> const& param_names
+                            , util::symbol name
+                            , std::vector<util::symbol> const& param_names
                             , util::sptr<Filter> body)
 {
-    _accumulator.defFunc(pos, name + FUNC_DEF_FILTERED, param_names, std::move(body));
+    _accumulator.defFunc(pos, name.str() + FUNC_DEF_FILTERED, param_names, std::move(body));
 }
 
 util::sref<SymbolTable> SymbolDefFilter::getSymbols()
@@ -317,7 +317,7 @@ util::sptr<proto::Statement> Branch::compile(util::sref<proto::Block>
 util::sptr<proto::Statement> VarDef::compile(util::sref<proto::Block>
                                            , util::sref<SymbolTable>) const 
 {
-    DataTree::actualOne()(pos, VAR_DEF, name);
+    DataTree::actualOne()(pos, VAR_DEF, name.str());
     init->compile(nulblock, nulSymbols());
     return nulProtoStmt();
 }
@@ -375,7 +375,7 @@ util::sptr<proto::Expression const> Negation::compile(util::sref<proto::Block>
 util::sptr<proto::Expression const> Reference::compile(util::sref<proto::Block>
                                                      , util::sref<SymbolTable>) const
 {
-    DataTree::actualOne()(pos, REFERENCE, name);
+    DataTree::actualOne()(pos, REFERENCE, name.str());
     return nulProtoExpr();
 }
 
@@ -444,7 +444,7 @@ util::sptr<proto::Expression const> ListAppend::compile(util::sref<proto::Block>
 util::sptr<proto::Expression const> Call::compile(util::sref<proto::Block>
                                                 , util::sref<SymbolTable>) const
 {
-    DataTree::actualOne()(pos, CALL, name, args.size());
+    DataTree::actualOne()(pos, CALL, name.str(), args.size());
     compileList(args);
     return nulProtoExpr();
 }
@@ -461,7 +461,7 @@ util::sptr<proto::Expression const> MemberCall::compile(util::sref<proto::Block>
 util::sptr<proto::Expression const> FuncReference::compile(util::sref<proto::Block>
                                                          , util::sref<SymbolTable>) const
 {
-    DataTree::actualOne()(pos, FUNC_REFERENCE, name, param_count);
+    DataTree::actualOne()(pos, FUNC_REFERENCE, name.str(), param_count);
     return nulProtoExpr();
 }
 
@@ -505,6 +505,21 @@ bool Expression::boolValue() const
     return false;
 }
 
+bool Expression::appendToLiteralList(std::vector<platform::int_type>&) const
+{
+    return false;
+}
+
+bool Expression::appendToLiteralList(std::vector<platform::float_type>&) const
+{
+    return false;
+}
+
+bool Expression::appendToLiteralList(std::vector<bool>&) const
+{
+    return false;
+}
+
 util::sptr<Expression const> Expression::operate(misc::position const&
                                                , std::string const&
                                                , mpz_class const&) const
@@ -658,6 +673,11 @@ bool BoolLiteral::boolValue() const
     return false;
 }
 
+bool BoolLiteral::appendToLiteralList(std::vector<bool>&) const
+{
+    return false;
+}
+
 std::string BoolLiteral::typeName() const
 {
     return "";
@@ -711,6 +731,11 @@ bool IntLiteral::boolValue() const
     return false;
 }
 
+bool IntLiteral::appendToLiteralList(std::vector<platform::int_type>&) const
+{
+    return false;
+}
+
 std::string IntLiteral::typeName() const
 {
     return "";
@@ -764,6 +789,11 @@ bool FloatLiteral::boolValue() const
     return false;
 }
 
+bool FloatLiteral::appendToLiteralList(std::vector<platform::float_type>&) const
+{
+    return false;
+}
+
 std::string FloatLiteral::typeName() const
 {
     return "";
@@ -229,7 +229,7 @@ TEST_F(AcceptorTest, FuncAcceptor)
     TestAcceptor receiver;
 
     grammar::FunctionAcceptor func_acc0(pos
-                                      , "func1", std::vector<std::string>({ "Duke", "Duran" }));
+                                      , "func1", std::vector<util::symbol>({ "Duke", "Duran" }));
     func_acc0.acceptStmt(util::mkptr(new grammar::Arithmetics(pos, util::mkptr(
                                                     new grammar::FloatLiteral(pos, "21.37")))));
     func_acc0.acceptStmt(util::mkptr(new grammar::VarDef(pos, "SonOfKorhal", util::mkptr(
@@ -257,7 +257,7 @@ TEST_F(AcceptorTest, FuncAcceptor)
     ASSERT_FALSE(error::hasError());
 
     misc::position pos_else(10);
-    grammar::FunctionAcceptor func_acc1(pos, "func2", std::vector<std::string>({ "Mengsk" }));
+    grammar::FunctionAcceptor func_acc1(pos, "func2", std::vector<util::symbol>({ "Mengsk" }));
     func_acc1.acceptElse(pos_else);
     ASSERT_TRUE(error::hasError());
     ASSERT_EQ(1, getElseNotMatches().size());
@@ -270,13 +270,13 @@ TEST_F(AcceptorTest, FuncAccNested)
     TestAcceptor receiver;
 
     grammar::FunctionAcceptor func_acc0(pos
-                                      , "funca", std::vector<std::string>({ "firebat", "ghost" }));
+                                      , "funca", std::vector<util::symbol>({ "firebat", "ghost" }));
     func_acc0.acceptStmt(util::mkptr(new grammar::Arithmetics(pos, util::mkptr(
                                                 new grammar::FloatLiteral(pos, "22.15")))));
     func_acc0.acceptStmt(util::mkptr(new grammar::VarDef(pos, "medic", util::mkptr(
                                                 new grammar::Reference(pos, "wraith")))));
 
-    grammar::FunctionAcceptor func_acc1(pos, "funca", std::vector<std::string>({ "vulture" }));
+    grammar::FunctionAcceptor func_acc1(pos, "funca", std::vector<util::symbol>({ "vulture" }));
     func_acc1.acceptStmt(util::mkptr(new grammar::Arithmetics(pos, util::mkptr(
                                                 new grammar::Reference(pos, "goliath")))));
 
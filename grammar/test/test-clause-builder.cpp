@@ -29,7 +29,7 @@ TEST_F(ClauseBuilderTest, AcceptorStackNext)
                                             new grammar::Reference(item_pos, "ruby")))));
     stack0.nextFunc(0, util::mkptr(new grammar::Function(item_pos
                                                        , "skull"
-                                                       , std::vector<std::string>({ "chipped" })
+                                                       , std::vector<util::symbol>({ "chipped" })
                                                        , std::move(grammar::Block()))));
     ASSERT_FALSE(error::hasError());
     grammar::Block block0(std::move(stack0.packAll()));
@@ -58,7 +58,7 @@ TEST_F(ClauseBuilderTest, AcceptorStackNext)
                                             new grammar::FloatLiteral(item_pos, "19.55")))));
     stack0.nextFunc(4, util::mkptr(new grammar::Function(err_pos1
                                                        , "ith"
-                                                       , std::vector<std::string>({ "el", "eth" })
+                                                       , std::vector<util::symbol>({ "el", "eth" })
                                                        , std::move(grammar::Block()))));
     ASSERT_TRUE(error::hasError());
     ASSERT_EQ(2, getExcessInds().size());
@@ -76,7 +76,7 @@ TEST_F(ClauseBuilderTest, AcceptorStackAdd)
                                             new grammar::Reference(item_pos, "eaglehorn")))));
     stack0.add(0, util::mkptr(new grammar::FunctionAcceptor(acc_pos
                                                           , "witherstring"
-                                                          , std::vector<std::string>())));
+                                                          , std::vector<util::symbol>())));
     stack0.nextStmt(1, util::mkptr(new grammar::VarDef(item_pos, "cedar_bow", util::mkptr(
                                             new grammar::Reference(item_pos, "kuko_shakaku")))));
     stack0.nextStmt(1, util::mkptr(new grammar::Arithmetics(item_pos, util::mkptr(
@@ -103,7 +103,7 @@ TEST_F(ClauseBuilderTest, AcceptorStackAdd)
     grammar::AcceptorStack stack1;
     stack1.add(0, util::mkptr(new grammar::FunctionAcceptor(acc_pos
                                                           , "witherstring"
-                                                          , std::vector<std::string>())));
+                                                          , std::vector<util::symbol>())));
     stack1.nextStmt(1, util::mkptr(new grammar::VarDef(item_pos, "cedar_bow", util::mkptr(
                                             new grammar::Reference(item_pos, "kuko_shakaku")))));
     stack1.nextStmt(0, util::mkptr(new grammar::Arithmetics(item_pos, util::mkptr(
@@ -188,7 +188,7 @@ TEST_F(ClauseBuilderTest, ClauseBuilder)
     builder0.addFunction(0
                        , item_pos1
                        , "goldenstrike_arch"
-                       , std::vector<std::string>({ "amn", "tir" }));
+                       , std::vector<util::symbol>({ "amn", "tir" }));
         builder0.addArith(1, util::mkptr(new grammar::Reference(item_pos1, "widowmaker")));
 
     builder0.buildAndClear()->compile(nulblock);
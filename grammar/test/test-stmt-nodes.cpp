@@ -193,7 +193,7 @@ TEST_F(StmtNodesTest, Functions)
 {
     misc::position pos(8);
     util::sptr<flchk::Filter> filter(std::move(mkfilter()));
-    grammar::Function func0(pos, "func0", std::vector<std::string>(), std::move(grammar::Block()));
+    grammar::Function func0(pos, "func0", std::vector<util::symbol>(), std::move(grammar::Block()));
     func0.compile(*filter);
 
     grammar::Block body;
@@ -203,7 +203,7 @@ TEST_F(StmtNodesTest, Functions)
     body.addStmt(std::move(util::mkptr(new grammar::ReturnNothing(pos))));
     grammar::Function func1(pos
                           , "func1"
-                          , std::vector<std::string>({ "Konata", "Kagami", "Tsukasa", "Miyuki" })
+                          , std::vector<util::symbol>({ "Konata", "Kagami", "Tsukasa", "Miyuki" })
                           , std::move(body));
     func1.compile(*filter);
     filter->compile(nulblock);
@@ -239,12 +239,12 @@ TEST_F(StmtNodesTest, Mixed)
     util::sptr<grammar::Function> func_nested0(new grammar::Function(
                                                         pos
                                                       , "funcn"
-                                                      , std::vector<std::string>({ "SOS" })
+                                                      , std::vector<util::symbol>({ "SOS" })
                                                       , std::move(block_nested)));
     util::sptr<grammar::Function> func_nested1(new grammar::Function(
                                                         pos
                                                       , "funcn"
-                                                      , std::vector<std::string>()
+                                                      , std::vector<util::symbol>()
                                                       , std::move(grammar::Block())));
 
     grammar::Block body;
@@ -257,7 +257,7 @@ TEST_F(StmtNodesTest, Mixed)
 
     grammar::Function func(pos
                          , "funco"
-                         , std::vector<std::string>({ "Suzumiya", "Koizumi", "Nagato", "Asahina" })
+                         , std::vector<util::symbol>({ "Suzumiya", "Koizumi", "Nagato", "Asahina" })
                          , std::move(body));
     func.compile(*filter);
     filter->compile(nulblock);
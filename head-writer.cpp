@@ -6,12 +6,25 @@
 
 std::string const HEAD_TEMPLATE(
 "#include <algorithm>\n"
+"#include <atomic>\n"
+"#include <cmath>\n"
+"#include <condition_variable>\n"
+"#include <cstdio>\n"
+"#include <cstdlib>\n"
+"#include <cstring>\n"
+"#include <deque>\n"
 "#include <iostream>\n"
+"#include <mutex>\n"
+"#include <thread>\n"
+"#include <utility>\n"
+"#include <vector>\n"
 "\n"
 "typedef $INT_TYPE_NAME _stk_type_int;\n"
 "typedef $FLOAT_TYPE_NAME _stk_type_float;\n"
 "typedef $BOOLEAN_TYPE_NAME _stk_type_1_byte;\n"
 "\n"
+"int const _stk_list_inline_size = $LIST_INLINE_SIZE;\n"
+"\n"
 );
 
 int main()
@@ -19,11 +32,13 @@ int main()
     std::cout <<
         util::replace_all(
         util::replace_all(
+        util::replace_all(
         util::replace_all(
             HEAD_TEMPLATE
                 , "$INT_TYPE_NAME", platform::int_traits::type_name())
                 , "$FLOAT_TYPE_NAME", platform::float_traits::type_name())
                 , "$BOOLEAN_TYPE_NAME", platform::bool_traits::type_name())
+                , "$LIST_INLINE_SIZE", util::str(platform::LIST_INLINE_SIZE))
     ;
     return 0;
 }
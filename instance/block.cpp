@@ -4,6 +4,7 @@
 
 #include "node-base.h"
 #include "block.h"
+#include "last-read.h"
 
 using namespace inst;
 
@@ -23,3 +24,33 @@ void Block::write() const
                   });
     output::blockEnd();
 }
+
+void Block::collectReads(ReadSet& reads) const
+{
+    std::for_each(_stmts.begin()
+                , _stmts.end()
+                , [&](util::sptr<Statement const> const& stmt)
+                  {
+                      stmt->collectReads(reads);
+                  });
+}
+
+void Block::markLastReads(LiveSlots& live) const
+{
+    std::for_each(_stmts.rbegin()
+                , _stmts.rend()
+                , [&](util::sptr<Statement const> const& stmt)
+                  {
+                      stmt->markLastReads(live);
+                  });
+}
+
+void Block::markTailCalls(util::sref<Function const> func) const
+{
+    std::for_each(_stmts.begin()
+                , _stmts.end()
+                , [&](util::sptr<Statement const> const& stmt)
+                  {
+                      stmt->markTailCalls(func);
+                  });
+}
@@ -24,6 +24,9 @@ namespace inst {
         {}
 
         void write() const;
+        void collectReads(ReadSet& reads) const;
+        void markLastReads(LiveSlots& live) const;
+        void markTailCalls(util::sref<Function const> func) const;
     private:
         std::list<util::sptr<Statement const>> _stmts;
     };
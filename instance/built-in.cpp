@@ -3,6 +3,7 @@
 #include <output/built-in-writer.h>
 
 #include "built-in.h"
+#include "last-read.h"
 
 using namespace inst;
 
@@ -12,3 +13,9 @@ void WriterExpr::write() const
     expr->write();
     output::endWriterStmt();
 }
+
+void WriterExpr::collectReads(ReadSet& reads) const
+{
+    reads.write();
+    expr->collectReads(reads);
+}
@@ -17,6 +17,7 @@ namespace inst {
         {}
 
         void write() const;
+        void collectReads(ReadSet& reads) const;
 
         util::sptr<Expression const> const expr;
     };
@@ -4,6 +4,7 @@
 #include <output/expr-writer.h>
 
 #include "expr-nodes.h"
+#include "last-read.h"
 
 using namespace inst;
 
@@ -40,6 +41,44 @@ void ListLiteral::write() const
     output::listEnd();
 }
 
+void StaticListBase::write() const
+{
+    output::staticList(list_id);
+}
+
+static void writeStaticMember(platform::int_type value)
+{
+    output::writeInt(value);
+}
+
+static void writeStaticMember(platform::float_type value)
+{
+    output::writeFloat(value);
+}
+
+static void writeStaticMember(bool value)
+{
+    output::writeBool(value);
+}
+
+template <typename _Value>
+void StaticListLiteral<_Value>::writeDef() const
+{
+    output::staticListBegin(list_id, member_type->exportedName());
+    std::for_each(value.begin()
+                , value.end()
+                , [&](_Value const& member)
+                  {
+                      writeStaticMember(member);
+                      output::staticListMemberEnd();
+                  });
+    output::staticListEnd(list_id, member_type->exportedName(), value.size());
+}
+
+template struct inst::StaticListLiteral<platform::int_type>;
+template struct inst::StaticListLiteral<platform::float_type>;
+template struct inst::StaticListLiteral<bool>;
+
 void ListElement::write() const
 {
     output::pipeElement();
@@ -52,12 +91,30 @@ void ListIndex::write() const
 
 void Reference::write() const
 {
-    output::refLevel(address.offset, address.level, type->exportedName());
+    if (frame_slot) {
+        if (last_read) {
+            output::moveRefThisFrame(address.offset);
+        } else {
+            output::refThisFrame(address.offset);
+        }
+    } else if (last_read) {
+        output::moveRefLevel(address.offset, address.level, type->exportedName());
+    } else {
+        output::refLevel(address.offset, address.level, type->exportedName());
+    }
 }
 
 void Call::write() const
 {
-    output::writeCallBegin(call_sn);
+    if (memoized && plain) {
+        output::writePlainMemoCallBegin(call_sn);
+    } else if (memoized) {
+        output::writeMemoCallBegin(call_sn);
+    } else if (plain) {
+        output::writePlainCallBegin(call_sn);
+    } else {
+        output::writeCallBegin(call_sn);
+    }
     std::for_each(args.begin()
                 , args.end()
                 , [&](util::sptr<Expression const> const& expr)
@@ -65,7 +122,13 @@ void Call::write() const
                        output::writeArgSeparator();
                        expr->write();
                   });
-    output::writeCallEnd();
+    if (memoized) {
+        output::writeMemoCallEnd();
+    } else if (plain) {
+        output::writePlainCallEnd();
+    } else {
+        output::writeCallEnd();
+    }
 }
 
 void MemberCall::write() const
@@ -210,3 +273,102 @@ void Negation::writePipeDef(int level) const
 {
     rhs->writePipeDef(level);
 }
+
+static void collectReadsInList(std::vector<util::sptr<Expression const>> const& list
+                             , ReadSet& reads)
+{
+    std::for_each(list.begin()
+                , list.end()
+                , [&](util::sptr<Expression const> const& element)
+                  {
+                      element->collectReads(reads);
+                  });
+}
+
+void ListLiteral::collectReads(ReadSet& reads) const
+{
+    reads.useFrame();
+    collectReadsInList(value, reads);
+}
+
+void StaticListBase::collectReads(ReadSet& reads) const
+{
+    reads.useFrame();
+    reads.staticList(util::mkref(*this));
+}
+
+void Reference::collectReads(ReadSet& reads) const
+{
+    reads.reference(util::mkref(*this));
+    if (type->isResource()) {
+        reads.readResource(util::mkref(*this));
+    } else {
+        reads.read(address);
+    }
+}
+
+void Call::collectReads(ReadSet& reads) const
+{
+    reads.call(util::mkref(*this));
+    collectReadsInList(args, reads);
+}
+
+util::sref<Call const> Call::callTo(util::serial_num func_sn) const
+{
+    if (func_sn.n == call_sn.n) {
+        return util::mkref(*this);
+    }
+    return util::sref<Call const>(nullptr);
+}
+
+void MemberCall::collectReads(ReadSet& reads) const
+{
+    object->collectReads(reads);
+    collectReadsInList(args, reads);
+}
+
+void FuncReference::collectReads(ReadSet& reads) const
+{
+    reads.useFrame();
+    std::for_each(args.begin()
+                , args.end()
+                , [&](ArgInfo const& arg)
+                  {
+                      reads.read(arg.address);
+                  });
+}
+
+void ListAppend::collectReads(ReadSet& reads) const
+{
+    reads.useFrame();
+    lhs->collectReads(reads);
+    rhs->collectReads(reads);
+}
+
+void BinaryOp::collectReads(ReadSet& reads) const
+{
+    lhs->collectReads(reads);
+    rhs->collectReads(reads);
+}
+
+void PreUnaryOp::collectReads(ReadSet& reads) const
+{
+    rhs->collectReads(reads);
+}
+
+void Conjunction::collectReads(ReadSet& reads) const
+{
+    lhs->collectReads(reads);
+    rhs->collectReads(reads);
+}
+
+void Disjunction::collectReads(ReadSet& reads) const
+{
+    lhs->collectReads(reads);
+    rhs->collectReads(reads);
+}
+
+void Negation::collectReads(ReadSet& reads) const
+{
+    rhs->collectReads(reads);
+}
@@ -67,11 +67,48 @@ namespace inst {
 
         void write() const;
         void writePipeDef(int level) const;
+        void collectReads(ReadSet& reads) const;
 
         util::sptr<Type const> const member_type;
         std::vector<util::sptr<Expression const>> const value;
     };
 
+    /*
+     * A list literal made of literals only.  All instances of the same source
+     * literal share list_id, and its members are defined once at namespace
+     * scope by writeStaticLists, so the expression itself only names them.
+     */
+    struct StaticListBase
+        : public Expression
+    {
+        StaticListBase(util::sptr<Type const> mt, util::id lid)
+            : member_type(std::move(mt))
+            , list_id(lid)
+        {}
+
+        void write() const;
+        void collectReads(ReadSet& reads) const;
+
+        virtual void writeDef() const = 0;
+
+        util::sptr<Type const> const member_type;
+        util::id const list_id;
+    };
+
+    template <typename _Value>
+    struct StaticListLiteral
+        : public StaticListBase
+    {
+        StaticListLiteral(util::sptr<Type const> mt, util::id lid, std::vector<_Value> v)
+            : StaticListBase(std::move(mt), lid)
+            , value(std::move(v))
+        {}
+
+        void writeDef() const;
+
+        std::vector<_Value> const value;
+    };
+
     struct ListElement
         : public Expression
     {
@@ -90,12 +127,17 @@ namespace inst {
         Reference(util::sptr<Type const> t, Address const& a)
             : type(std::move(t))
             , address(a)
+            , last_read(false)
+            , frame_slot(false)
         {}
 
         void write() const;
+        void collectReads(ReadSet& reads) const;
 
         util::sptr<Type const> const type;
         Address address;
+        mutable bool last_read;
+        mutable bool frame_slot;
     };
 
     struct Call
@@ -104,13 +146,19 @@ namespace inst {
         Call(util::serial_num c, std::vector<util::sptr<Expression const>> a)
             : call_sn(c)
             , args(std::move(a))
+            , memoized(false)
+            , plain(false)
         {}
 
         void write() const;
         void writePipeDef(int level) const;
+        void collectReads(ReadSet& reads) const;
+        util::sref<Call const> callTo(util::serial_num func_sn) const;
 
         util::serial_num const call_sn;
         std::vector<util::sptr<Expression const>> args;
+        mutable bool memoized;
+        mutable bool plain;
     };
 
     struct MemberCall
@@ -126,6 +174,7 @@ namespace inst {
 
         void write() const;
         void writePipeDef(int level) const;
+        void collectReads(ReadSet& reads) const;
 
         util::sptr<Expression const> object;
         std::string const name;
@@ -161,6 +210,7 @@ namespace inst {
         {}
 
         void write() const;
+        void collectReads(ReadSet& reads) const;
 
         int const size;
         std::list<ArgInfo> const args;
@@ -176,6 +226,7 @@ namespace inst {
 
         void write() const;
         void writePipeDef(int level) const;
+        void collectReads(ReadSet& reads) const;
 
         util::sptr<Expression const> const lhs;
         util::sptr<Expression const> const rhs;
@@ -194,6 +245,7 @@ namespace inst {
 
         void write() const;
         void writePipeDef(int level) const;
+        void collectReads(ReadSet& reads) const;
 
         util::sptr<Expression const> const lhs;
         std::string const op;
@@ -210,6 +262,7 @@ namespace inst {
 
         void write() const;
         void writePipeDef(int level) const;
+        void collectReads(ReadSet& reads) const;
 
         std::string const op;
         util::sptr<Expression const> const rhs;
@@ -225,6 +278,7 @@ namespace inst {
 
         void write() const;
         void writePipeDef(int level) const;
+        void collectReads(ReadSet& reads) const;
 
         util::sptr<Expression const> const lhs;
         util::sptr<Expression const> const rhs;
@@ -240,6 +294,7 @@ namespace inst {
 
         void write() const;
         void writePipeDef(int level) const;
+        void collectReads(ReadSet& reads) const;
 
         util::sptr<Expression const> const lhs;
         util::sptr<Expression const> const rhs;
@@ -254,6 +309,7 @@ namespace inst {
 
         void write() const;
         void writePipeDef(int level) const;
+        void collectReads(ReadSet& reads) const;
 
         util::sptr<Expression const> const rhs;
     };
@@ -1,9 +1,14 @@
 #include <algorithm>
+#include <map>
+#include <set>
 
 #include <output/func-writer.h>
+#include <misc/options.h>
 
 #include "function.h"
 #include "node-base.h"
+#include "expr-nodes.h"
+#include "last-read.h"
 
 using namespace inst;
 
@@ -20,18 +25,175 @@ static std::vector<util::sptr<output::StackVarRec const>>
     return std::move(recs);
 }
 
+static std::vector<output::FrameSlot> toFrameSlots(std::list<Function::SlotInfo> const& slots)
+{
+    std::vector<output::FrameSlot> frame_slots;
+    std::for_each(slots.begin()
+                , slots.end()
+                , [&](Function::SlotInfo const& slot)
+                  {
+                      frame_slots.push_back(output::FrameSlot(slot.type->exportedName()
+                                                            , slot.offset
+                                                            , slot.size));
+                  });
+    return frame_slots;
+}
+
+static std::vector<output::FrameSlot> toResSlots(std::vector<int> const& res_entries
+                                               , std::list<Function::SlotInfo> const& slots)
+{
+    std::vector<output::FrameSlot> res_slots;
+    std::for_each(slots.begin()
+                , slots.end()
+                , [&](Function::SlotInfo const& slot)
+                  {
+                      if (res_entries.end() != std::find(res_entries.begin()
+                                                       , res_entries.end()
+                                                       , slot.offset))
+                      {
+                          res_slots.push_back(output::FrameSlot(slot.type->exportedName()
+                                                              , slot.offset
+                                                              , slot.size));
+                      }
+                  });
+    return res_slots;
+}
+
 void Function::writeDecl() const
 {
-      output::writeFuncDecl(return_type->exportedName()
-                          , call_sn
-                          , toStackVars(params)
-                          , level
-                          , stack_size
-                          , res_entries.size());
+      std::vector<util::sptr<output::StackVarRec const>> stack_vars(toStackVars(params));
+      if (plain) {
+          output::writePlainFuncDecl(return_type->exportedName()
+                                   , call_sn
+                                   , stack_vars
+                                   , toFrameSlots(frame_slots)
+                                   , stack_size);
+      } else {
+          output::writeFuncDecl(return_type->exportedName()
+                              , call_sn
+                              , stack_vars
+                              , toFrameSlots(frame_slots)
+                              , level
+                              , outer_levels
+                              , stack_size
+                              , toResSlots(res_entries, frame_slots));
+      }
+      if (memoized) {
+          output::writeMemoTable(return_type->exportedName(), call_sn, stack_vars);
+      }
 }
 
 void Function::writeImpl() const
 {
-      output::writeFuncImpl(return_type->exportedName(), call_sn);
+      if (plain) {
+          output::writePlainFuncImpl(return_type->exportedName()
+                                   , call_sn
+                                   , toStackVars(params)
+                                   , level);
+      } else {
+          output::writeFuncImpl(return_type->exportedName(), call_sn);
+      }
+      if (self_tail_call) {
+          output::writeTailCallEntry();
+      }
       body->write();
+      output::writeFuncImplEnd(return_type->exportedName());
+}
+
+/*
+ * The arguments are evaluated before the resources in the frame are released
+ * and the parameters overwritten, since they may read any slot of it.
+ */
+void Function::writeTailCall(std::vector<util::sptr<Expression const>> const& args) const
+{
+    output::tailCallBegin();
+    int index = 0;
+    auto param = params.begin();
+    std::for_each(args.begin()
+                , args.end()
+                , [&](util::sptr<Expression const> const& arg)
+                  {
+                      output::tailCallArgBegin(index++, param->type->exportedName());
+                      arg->write();
+                      output::tailCallArgEnd();
+                      ++param;
+                  });
+    output::tailCallEnd(toStackVars(params), toResSlots(res_entries, frame_slots));
+}
+
+void inst::markTailCalls(std::vector<util::sptr<Function const>> const& funcs)
+{
+    if (!misc::options::get().tail_call) {
+        return;
+    }
+    std::for_each(funcs.begin()
+                , funcs.end()
+                , [&](util::sptr<Function const> const& func)
+                  {
+                      func->body->markTailCalls(*func);
+                  });
+}
+
+/*
+ * Only references to the function's own frame are named through its struct.
+ * A nested function is instantiated once for all instances of the enclosing
+ * one, so it still reaches outer frames by offset.
+ */
+void inst::markFrameSlots(std::vector<util::sptr<Function const>> const& funcs)
+{
+    if (!misc::options::get().typed_frame) {
+        return;
+    }
+    std::for_each(funcs.begin()
+                , funcs.end()
+                , [&](util::sptr<Function const> const& func)
+                  {
+                      std::map<int, std::string> slot_types;
+                      std::for_each(func->frame_slots.begin()
+                                  , func->frame_slots.end()
+                                  , [&](Function::SlotInfo const& slot)
+                                    {
+                                        if (0 != slot.size) {
+                                            slot_types[slot.offset] = slot.type->exportedName();
+                                        }
+                                    });
+                      ReadSet reads;
+                      func->body->collectReads(reads);
+                      std::for_each(reads.refs.begin()
+                                  , reads.refs.end()
+                                  , [&](util::sref<Reference const> ref)
+                                    {
+                                        auto slot = slot_types.find(ref->address.offset);
+                                        if (func->level == ref->address.level
+                                                && slot_types.end() != slot
+                                                && ref->type->exportedName() == slot->second)
+                                        {
+                                            ref->frame_slot = true;
+                                        }
+                                    });
+                  });
+}
+
+/*
+ * Every instance of a function made from the same list literal shares its
+ * members, which are defined once ahead of the function declarations.
+ */
+void inst::writeStaticLists(std::vector<util::sptr<Function const>> const& funcs)
+{
+    std::set<util::id> written;
+    std::for_each(funcs.begin()
+                , funcs.end()
+                , [&](util::sptr<Function const> const& func)
+                  {
+                      ReadSet reads;
+                      func->body->collectReads(reads);
+                      std::for_each(reads.static_lists.begin()
+                                  , reads.static_lists.end()
+                                  , [&](util::sref<StaticListBase const> list)
+                                    {
+                                        if (written.insert(list->list_id).second) {
+                                            list->writeDef();
+                                        }
+                                    });
+                  });
 }
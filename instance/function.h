@@ -3,6 +3,7 @@
 
 #include <string>
 #include <list>
+#include <vector>
 
 #include <util/sn.h>
 #include <util/pointer.h>
@@ -29,10 +30,29 @@ namespace inst {
             {}
         };
 
+        struct SlotInfo {
+            util::sptr<Type const> type;
+            int const offset;
+            int const size;
+
+            SlotInfo(util::sptr<Type const> t, int o, int s)
+                : type(std::move(t))
+                , offset(o)
+                , size(s)
+            {}
+
+            SlotInfo(SlotInfo&& rhs)
+                : type(std::move(rhs.type))
+                , offset(rhs.offset)
+                , size(rhs.size)
+            {}
+        };
+
         Function(util::sptr<Type const> rt
                , int l
                , int ss
                , std::list<ParamInfo> p
+               , std::list<SlotInfo> fs
                , util::serial_num c
                , std::vector<int> const& re
                , util::sptr<Statement const> b)
@@ -40,23 +60,41 @@ namespace inst {
             , level(l)
             , stack_size(ss)
             , params(std::move(p))
+            , frame_slots(std::move(fs))
             , call_sn(c)
             , res_entries(re)
             , body(std::move(b))
-        {}
+            , memoized(false)
+            , self_tail_call(false)
+            , plain(false)
+        {
+            for (int outer_level = 0; outer_level < level; ++outer_level) {
+                outer_levels.push_back(outer_level);
+            }
+        }
 
         void writeDecl() const;
         void writeImpl() const;
+        void writeTailCall(std::vector<util::sptr<Expression const>> const& args) const;
 
         util::sptr<Type const> const return_type;
         int const level;
         int const stack_size;
         std::list<ParamInfo> const params;
+        std::list<SlotInfo> const frame_slots;
         util::serial_num const call_sn;
         std::vector<int> const res_entries;
         util::sptr<Statement const> const body;
+        mutable bool memoized;
+        mutable bool self_tail_call;
+        mutable bool plain;
+        mutable std::vector<int> outer_levels;
     };
 
+    void markTailCalls(std::vector<util::sptr<Function const>> const& funcs);
+    void markFrameSlots(std::vector<util::sptr<Function const>> const& funcs);
+    void writeStaticLists(std::vector<util::sptr<Function const>> const& funcs);
+
 }
 
 #endif /* __STEKIN_INSTANCE_FUNCTION_H__ */
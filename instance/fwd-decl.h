@@ -5,9 +5,15 @@ namespace inst {
 
     struct Expression;
     struct Statement;
+    struct Reference;
+    struct Call;
+    struct StaticListBase;
     struct PipeBase;
+    struct SliceBound;
     struct Block;
     struct Function;
+    struct ReadSet;
+    struct LiveSlots;
 
 }
 
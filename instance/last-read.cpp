@@ -0,0 +1,143 @@
+#include <algorithm>
+#include <map>
+
+#include <misc/options.h>
+
+#include "last-read.h"
+#include "function.h"
+#include "expr-nodes.h"
+
+using namespace inst;
+
+void ReadSet::read(Address const& address)
+{
+    slots.push_back(address);
+}
+
+void ReadSet::readResource(util::sref<Reference const> ref)
+{
+    slots.push_back(ref->address);
+    resource_refs.push_back(ref);
+}
+
+void ReadSet::reference(util::sref<Reference const> ref)
+{
+    refs.push_back(ref);
+}
+
+void ReadSet::readSlots(ReadSet const& reads)
+{
+    std::for_each(reads.slots.begin()
+                , reads.slots.end()
+                , [&](Address const& address)
+                  {
+                      slots.push_back(address);
+                  });
+    calls.insert(calls.end(), reads.calls.begin(), reads.calls.end());
+    static_lists.insert(static_lists.end(), reads.static_lists.begin(), reads.static_lists.end());
+    pipes.insert(pipes.end(), reads.pipes.begin(), reads.pipes.end());
+    writes = writes || reads.writes;
+    uses_frame = uses_frame || reads.uses_frame;
+}
+
+void ReadSet::call(util::sref<Call const> c)
+{
+    calls.push_back(c);
+}
+
+void ReadSet::write()
+{
+    writes = true;
+}
+
+void ReadSet::useFrame()
+{
+    uses_frame = true;
+}
+
+void ReadSet::staticList(util::sref<StaticListBase const> list)
+{
+    static_lists.push_back(list);
+}
+
+void ReadSet::pipe(util::sref<PipeBase const> p)
+{
+    pipes.push_back(p);
+}
+
+void LiveSlots::statementReads(ReadSet const& reads)
+{
+    std::map<int, int> read_counts;
+    std::for_each(reads.slots.begin()
+                , reads.slots.end()
+                , [&](Address const& address)
+                  {
+                      if (level == address.level) {
+                          ++read_counts[address.offset];
+                      }
+                  });
+    std::for_each(reads.resource_refs.begin()
+                , reads.resource_refs.end()
+                , [&](util::sref<Reference const> ref)
+                  {
+                      int offset = ref->address.offset;
+                      if (level == ref->address.level
+                              && 1 == read_counts[offset]
+                              && 0 == live.count(offset)
+                              && 0 == escaped->count(offset))
+                      {
+                          ref->last_read = true;
+                      }
+                  });
+    std::for_each(read_counts.begin()
+                , read_counts.end()
+                , [&](std::pair<int const, int> const& count)
+                  {
+                      live.insert(count.first);
+                  });
+}
+
+void LiveSlots::define(int offset)
+{
+    live.erase(offset);
+}
+
+void LiveSlots::clear()
+{
+    live.clear();
+}
+
+void LiveSlots::join(LiveSlots const& rhs)
+{
+    live.insert(rhs.live.begin(), rhs.live.end());
+}
+
+void inst::markLastReads(std::vector<util::sptr<Function const>> const& funcs)
+{
+    if (!misc::options::get().move_last_read) {
+        return;
+    }
+    std::map<int, std::set<int>> escaped;
+    std::for_each(funcs.begin()
+                , funcs.end()
+                , [&](util::sptr<Function const> const& func)
+                  {
+                      ReadSet reads;
+                      func->body->collectReads(reads);
+                      std::for_each(reads.slots.begin()
+                                  , reads.slots.end()
+                                  , [&](Address const& address)
+                                    {
+                                        if (address.level < func->level) {
+                                            escaped[address.level].insert(address.offset);
+                                        }
+                                    });
+                  });
+    std::for_each(funcs.begin()
+                , funcs.end()
+                , [&](util::sptr<Function const> const& func)
+                  {
+                      LiveSlots live(func->level, util::mkref(escaped[func->level]));
+                      func->body->markLastReads(live);
+                  });
+}
@@ -0,0 +1,75 @@
+#ifndef __STEKIN_INSTANCE_LAST_READ_H__
+#define __STEKIN_INSTANCE_LAST_READ_H__
+
+#include <vector>
+#include <set>
+
+#include <util/pointer.h>
+
+#include "fwd-decl.h"
+#include "address.h"
+
+namespace inst {
+
+    /*
+     * Frame slots read by a statement or a function body, together with the
+     * calls it makes and whether it writes, which decide if it is pure.  refs
+     * holds the references written in the body itself, not in pipe stages.
+     * uses_frame is set by lists and closures, which are built in or capture
+     * the frame and keep a function from being plain.  static_lists holds
+     * the static list literals anywhere in it, pipe stages included, and pipes
+     * the stages of every pipeline in it.
+     */
+    struct ReadSet {
+        ReadSet()
+            : writes(false)
+            , uses_frame(false)
+        {}
+
+        void read(Address const& address);
+        void readResource(util::sref<Reference const> ref);
+        void reference(util::sref<Reference const> ref);
+        void readSlots(ReadSet const& reads);
+        void call(util::sref<Call const> c);
+        void write();
+        void useFrame();
+        void staticList(util::sref<StaticListBase const> list);
+        void pipe(util::sref<PipeBase const> p);
+
+        std::vector<Address> slots;
+        std::vector<util::sref<Reference const>> resource_refs;
+        std::vector<util::sref<Reference const>> refs;
+        std::vector<util::sref<Call const>> calls;
+        std::vector<util::sref<StaticListBase const>> static_lists;
+        std::vector<util::sref<PipeBase const>> pipes;
+        bool writes;
+        bool uses_frame;
+    };
+
+    /*
+     * Slots of the frame at level that are read again later, while walking a
+     * function body backwards.  A statement reading a resource slot that is
+     * not live after it, and reading it only once, moves it out of the frame.
+     * Slots in escaped are also read by nested functions and never moved.
+     */
+    struct LiveSlots {
+        LiveSlots(int l, util::sref<std::set<int> const> e)
+            : level(l)
+            , escaped(e)
+        {}
+
+        void statementReads(ReadSet const& reads);
+        void define(int offset);
+        void clear();
+        void join(LiveSlots const& rhs);
+
+        int const level;
+        util::sref<std::set<int> const> const escaped;
+        std::set<int> live;
+    };
+
+    void markLastReads(std::vector<util::sptr<Function const>> const& funcs);
+
+}
+
+#endif /* __STEKIN_INSTANCE_LAST_READ_H__ */
@@ -1,71 +1,309 @@
 #include <algorithm>
 
 #include <output/func-writer.h>
+#include <output/expr-writer.h>
+#include <output/name-mangler.h>
 
 #include "list-pipe.h"
+#include "last-read.h"
 
 using namespace inst;
 
-void PipeMap::begin() const
+std::string PipeMap::srcMemberTypeName() const
 {
-    output::pipeBegin(util::id(this));
+    return src_member_type->exportedName();
 }
 
-void PipeMap::end() const
+std::string PipeMap::dstMemberTypeName() const
 {
-    output::pipeEnd();
+    return dst_member_type->exportedName();
+}
+
+bool PipeMap::renumbersIndex() const
+{
+    return false;
 }
 
-void PipeMap::writeDef(int level) const
+void PipeMap::writeCounter(bool) const {}
+
+void PipeMap::writeStageBegin(bool) const
 {
-    output::pipeMapBegin(util::id(this)
-                       , level
-                       , src_member_type->exportedName()
-                       , dst_member_type->exportedName());
+    output::pipeMapBegin(util::id(this), dstMemberTypeName());
     expr->write();
-    output::pipeMapEnd();
+    output::pipeMapEnd(util::id(this), dstMemberTypeName());
 }
 
-void PipeFilter::begin() const
+void PipeMap::writeStageEnd() const
 {
-    output::pipeBegin(util::id(this));
+    output::pipeStageEnd();
 }
 
-void PipeFilter::end() const
+std::string PipeFilter::srcMemberTypeName() const
 {
-    output::pipeEnd();
+    return member_type->exportedName();
+}
+
+std::string PipeFilter::dstMemberTypeName() const
+{
+    return member_type->exportedName();
 }
 
-void PipeFilter::writeDef(int level) const
+bool PipeFilter::renumbersIndex() const
 {
-    output::pipeFilterBegin(util::id(this), level, member_type->exportedName());
+    return true;
+}
+
+void PipeFilter::writeCounter(bool index_read) const
+{
+    if (index_read) {
+        output::pipeFilterCounter(util::id(this));
+    }
+}
+
+void PipeFilter::writeStageBegin(bool index_read) const
+{
+    output::pipeFilterBegin();
     expr->write();
-    output::pipeFilterEnd();
+    output::pipeFilterEnd(util::id(this), index_read);
+}
+
+void PipeFilter::writeStageEnd() const
+{
+    output::pipeStageEnd();
+}
+
+/*
+ * A stage that may write ends a run of fused stages, and the next run loops
+ * over the list the run before it built.
+ */
+std::vector<int> ListPipeline::_runBegins() const
+{
+    std::vector<int> begins(1, 0);
+    for (int i = 0; i < int(pipeline.size()) - 1; ++i) {
+        if (pipeline[i]->may_write) {
+            begins.push_back(i + 1);
+        }
+    }
+    return begins;
+}
+
+util::id ListPipeline::_runId(int begin) const
+{
+    return 0 == begin ? util::id(this) : pipeline[begin].id();
 }
 
 void ListPipeline::write() const
 {
-    std::for_each(pipeline.rbegin()
-                , pipeline.rend()
-                , [&](util::sptr<PipeBase const> const& pipe)
+    if (pipeline.empty()) {
+        list->write();
+        return;
+    }
+    std::vector<int> begins(_runBegins());
+    std::for_each(begins.rbegin()
+                , begins.rend()
+                , [&](int begin)
                   {
-                      pipe->begin();
+                      output::pipeBegin(_runId(begin));
                   });
     list->write();
-    std::for_each(pipeline.begin()
-                , pipeline.end()
-                , [&](util::sptr<PipeBase const> const& pipe)
+    std::for_each(begins.begin()
+                , begins.end()
+                , [&](int)
                   {
-                      pipe->end();
+                      output::pipeEnd();
                   });
 }
 
 void ListPipeline::writePipeDef(int level) const
 {
+    list->writePipeDef(level);
+    if (pipeline.empty()) {
+        return;
+    }
+    std::vector<int> begins(_runBegins());
+    begins.push_back(pipeline.size());
+    for (int i = 0; i < int(begins.size()) - 1; ++i) {
+        _writeRunDef(begins[i], begins[i + 1]);
+    }
+}
+
+/*
+ * The stages of a run are fused into a single loop over its source list.
+ * Each stage opens a nested scope that rebinds the element (after a map) or
+ * the index (after a filter) for the stages following it, so no intermediate
+ * list is ever materialized.  The loop covers one chunk of the source list;
+ * a parallel pipeline has its chunks spread over the runtime thread pool.
+ *
+ * An index is bound, and a filter counts the members it passes, only if a
+ * stage reads that index before the next filter renumbers it.
+ */
+void ListPipeline::_writeRunDef(int begin, int end) const
+{
+    std::vector<bool> index_read_after(pipeline.size(), false);
+    bool index_read = false;
+    for (int i = end - 1; i >= begin; --i) {
+        index_read_after[i] = index_read;
+        index_read = pipeline[i]->uses_index || (!pipeline[i]->renumbersIndex() && index_read);
+    }
+
+    output::pipelineBegin(_runId(begin)
+                        , pipeline[begin]->srcMemberTypeName()
+                        , pipeline[end - 1]->dstMemberTypeName()
+                        , parallel);
+    for (int i = begin; i < end; ++i) {
+        pipeline[i]->writeCounter(index_read_after[i]);
+    }
+    output::pipelineLoopBegin(pipeline[begin]->srcMemberTypeName(), index_read);
+    for (int i = begin; i < end; ++i) {
+        pipeline[i]->writeStageBegin(index_read_after[i]);
+    }
+    output::pipelineLoopEnd();
+    for (int i = end - 1; i >= begin; --i) {
+        pipeline[i]->writeStageEnd();
+    }
+    output::pipelineEnd();
+}
+
+void ListSlice::write() const
+{
+    output::listSliceBegin();
+    list->write();
+    std::for_each(bounds.begin()
+                , bounds.end()
+                , [&](util::sptr<SliceBound const> const& bound)
+                  {
+                      output::listSliceBound(bound->op);
+                      bound->bound->write();
+                  });
+    output::listSliceEnd();
+}
+
+void ListSlice::writePipeDef(int level) const
+{
+    list->writePipeDef(level);
+}
+
+void KernelInvariant::write() const
+{
+    output::pipeKernelInvariant(index);
+}
+
+void PipeKernel::write() const
+{
+    output::pipeBegin(util::id(this));
+    list->write();
+    output::pipeEnd();
+}
+
+void PipeKernel::_writeMaps(std::string const& element_type) const
+{
+    std::for_each(maps.begin()
+                , maps.end()
+                , [&](util::sptr<Expression const> const& map)
+                  {
+                      output::pipeMapBegin(map.id(), element_type);
+                      map->write();
+                      output::pipeMapEnd(map.id(), element_type);
+                  });
+}
+
+void PipeKernel::_closeMaps() const
+{
+    std::for_each(maps.begin()
+                , maps.end()
+                , [&](util::sptr<Expression const> const&)
+                  {
+                      output::pipeStageEnd();
+                  });
+}
+
+/*
+ * Map-only pipelines of plain arithmetic on int or float members become a
+ * kernel: loop invariant operands are evaluated once before the loops, a
+ * vector loop handles whole SIMD widths and a scalar loop handles the tail.
+ * Both loops write the very same expressions, only the types of the element,
+ * the index and the invariants differ.  The index is kept up to date only
+ * when a map reads it.  An empty chunk returns before the invariants, which a
+ * map would only have evaluated for some member.
+ */
+void PipeKernel::writePipeDef(int level) const
+{
+    list->writePipeDef(level);
+    std::string const type_name(member_type->exportedName());
+    output::pipeKernelBegin(util::id(this), type_name, parallel);
+    for (int i = 0; i < int(invariants.size()); ++i) {
+        output::pipeKernelInvariantBegin(i, type_name);
+        invariants[i]->write();
+        output::pipeKernelInvariantEnd(i, type_name);
+    }
+
+    output::pipeKernelVectorLoopBegin(type_name, uses_index);
+    for (int i = 0; i < int(invariants.size()); ++i) {
+        output::pipeKernelVectorInvariant(i, type_name);
+    }
+    _writeMaps(output::formSimdType(type_name));
+    output::pipeKernelVectorLoopEnd(type_name);
+    _closeMaps();
+    output::pipeKernelLoopClose();
+
+    output::pipeKernelScalarLoopBegin(type_name, uses_index);
+    for (int i = 0; i < int(invariants.size()); ++i) {
+        output::pipeKernelScalarInvariant(i, type_name);
+    }
+    _writeMaps(type_name);
+    output::pipeKernelScalarLoopEnd();
+    _closeMaps();
+    output::pipeKernelLoopClose();
+    output::pipeKernelEnd();
+}
+
+/*
+ * Stages read the frame once per member, so none of their reads is a move;
+ * only the source list is read as part of the enclosing statement.
+ */
+void ListPipeline::collectReads(ReadSet& reads) const
+{
+    reads.useFrame();
+    list->collectReads(reads);
+    ReadSet stage_reads;
     std::for_each(pipeline.begin()
                 , pipeline.end()
                 , [&](util::sptr<PipeBase const> const& pipe)
                   {
-                      pipe->writeDef(level);
+                      pipe->expr->collectReads(stage_reads);
+                      stage_reads.pipe(*pipe);
+                  });
+    reads.readSlots(stage_reads);
+}
+
+void ListSlice::collectReads(ReadSet& reads) const
+{
+    reads.useFrame();
+    list->collectReads(reads);
+    std::for_each(bounds.begin()
+                , bounds.end()
+                , [&](util::sptr<SliceBound const> const& bound)
+                  {
+                      bound->bound->collectReads(reads);
+                  });
+}
+
+void PipeKernel::collectReads(ReadSet& reads) const
+{
+    reads.useFrame();
+    list->collectReads(reads);
+    ReadSet stage_reads;
+    std::for_each(invariants.begin()
+                , invariants.end()
+                , [&](util::sptr<Expression const> const& invariant)
+                  {
+                      invariant->collectReads(stage_reads);
+                  });
+    std::for_each(maps.begin()
+                , maps.end()
+                , [&](util::sptr<Expression const> const& map)
+                  {
+                      map->collectReads(stage_reads);
                   });
+    reads.readSlots(stage_reads);
 }
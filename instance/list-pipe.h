@@ -1,6 +1,7 @@
 #ifndef __STEKIN_INSTANCE_LIST_PIPELINE_H__
 #define __STEKIN_INSTANCE_LIST_PIPELINE_H__
 
+#include <string>
 #include <vector>
 
 #include <util/pointer.h>
@@ -13,31 +14,44 @@ namespace inst {
     struct PipeBase {
         virtual ~PipeBase() {}
 
-        explicit PipeBase(util::sptr<Expression const> e)
+        PipeBase(util::sptr<Expression const> e, bool ui)
             : expr(std::move(e))
+            , uses_index(ui)
+            , may_write(false)
         {}
 
-        virtual void begin() const = 0;
-        virtual void end() const = 0;
-        virtual void writeDef(int level) const = 0;
+        virtual std::string srcMemberTypeName() const = 0;
+        virtual std::string dstMemberTypeName() const = 0;
+        virtual bool renumbersIndex() const = 0;
+
+        virtual void writeCounter(bool index_read) const = 0;
+        virtual void writeStageBegin(bool index_read) const = 0;
+        virtual void writeStageEnd() const = 0;
 
         util::sptr<Expression const> expr;
+        bool const uses_index;
+        mutable bool may_write;
     };
 
     struct PipeMap
         : public PipeBase
     {
         PipeMap(util::sptr<Expression const> expr
+              , bool uses_index
               , util::sptr<Type const> st
               , util::sptr<Type const> dt)
-            : PipeBase(std::move(expr))
+            : PipeBase(std::move(expr), uses_index)
             , src_member_type(std::move(st))
             , dst_member_type(std::move(dt))
         {}
 
-        void begin() const;
-        void end() const;
-        void writeDef(int level) const;
+        std::string srcMemberTypeName() const;
+        std::string dstMemberTypeName() const;
+        bool renumbersIndex() const;
+
+        void writeCounter(bool) const;
+        void writeStageBegin(bool) const;
+        void writeStageEnd() const;
 
         util::sptr<Type const> src_member_type;
         util::sptr<Type const> dst_member_type;
@@ -46,14 +60,18 @@ namespace inst {
     struct PipeFilter
         : public PipeBase
     {
-        PipeFilter(util::sptr<Expression const> expr, util::sptr<Type const> mt)
-            : PipeBase(std::move(expr))
+        PipeFilter(util::sptr<Expression const> expr, bool uses_index, util::sptr<Type const> mt)
+            : PipeBase(std::move(expr), uses_index)
             , member_type(std::move(mt))
         {}
 
-        void begin() const;
-        void end() const;
-        void writeDef(int level) const;
+        std::string srcMemberTypeName() const;
+        std::string dstMemberTypeName() const;
+        bool renumbersIndex() const;
+
+        void writeCounter(bool index_read) const;
+        void writeStageBegin(bool index_read) const;
+        void writeStageEnd() const;
 
         util::sptr<Type const> member_type;
     };
@@ -61,16 +79,95 @@ namespace inst {
     struct ListPipeline
         : public Expression
     {
-        ListPipeline(util::sptr<Expression const> l, std::vector<util::sptr<PipeBase const>> p)
+        ListPipeline(util::sptr<Expression const> l
+                   , std::vector<util::sptr<PipeBase const>> p
+                   , bool par)
             : list(std::move(l))
             , pipeline(std::move(p))
+            , parallel(par)
         {}
 
         void write() const;
         void writePipeDef(int level) const;
+        void collectReads(ReadSet& reads) const;
 
         util::sptr<Expression const> const list;
         std::vector<util::sptr<PipeBase const>> const pipeline;
+        bool const parallel;
+    private:
+        std::vector<int> _runBegins() const;
+        util::id _runId(int begin) const;
+        void _writeRunDef(int begin, int end) const;
+    };
+
+    struct SliceBound {
+        SliceBound(std::string const& o, util::sptr<Expression const> b)
+            : op(o)
+            , bound(std::move(b))
+        {}
+
+        std::string const op;
+        util::sptr<Expression const> const bound;
+    };
+
+    struct ListSlice
+        : public Expression
+    {
+        ListSlice(util::sptr<Expression const> l, std::vector<util::sptr<SliceBound const>> b)
+            : list(std::move(l))
+            , bounds(std::move(b))
+        {}
+
+        void write() const;
+        void writePipeDef(int level) const;
+        void collectReads(ReadSet& reads) const;
+
+        util::sptr<Expression const> const list;
+        std::vector<util::sptr<SliceBound const>> const bounds;
+    };
+
+    struct KernelInvariant
+        : public Expression
+    {
+        explicit KernelInvariant(int i)
+            : index(i)
+        {}
+
+        void write() const;
+
+        int const index;
+    };
+
+    struct PipeKernel
+        : public Expression
+    {
+        PipeKernel(util::sptr<Expression const> l
+                 , util::sptr<Type const> mt
+                 , std::vector<util::sptr<Expression const>> i
+                 , std::vector<util::sptr<Expression const>> m
+                 , bool ui
+                 , bool par)
+            : list(std::move(l))
+            , member_type(std::move(mt))
+            , invariants(std::move(i))
+            , maps(std::move(m))
+            , uses_index(ui)
+            , parallel(par)
+        {}
+
+        void write() const;
+        void writePipeDef(int level) const;
+        void collectReads(ReadSet& reads) const;
+
+        util::sptr<Expression const> const list;
+        util::sptr<Type const> const member_type;
+        std::vector<util::sptr<Expression const>> const invariants;
+        std::vector<util::sptr<Expression const>> const maps;
+        bool const uses_index;
+        bool const parallel;
+    private:
+        void _writeMaps(std::string const& element_type) const;
+        void _closeMaps() const;
     };
 
 }
@@ -0,0 +1,172 @@
+#include <algorithm>
+#include <map>
+#include <set>
+
+#include <misc/options.h>
+
+#include "memoize.h"
+#include "last-read.h"
+#include "function.h"
+#include "expr-nodes.h"
+#include "list-pipe.h"
+
+using namespace inst;
+
+namespace {
+
+    struct FuncEffects {
+        explicit FuncEffects(util::sref<Function const> f)
+            : func(f)
+            , outermost_read(f->level)
+        {
+            func->body->collectReads(reads);
+            std::for_each(reads.slots.begin()
+                        , reads.slots.end()
+                        , [&](Address const& address)
+                          {
+                              outermost_read = std::min(outermost_read, address.level);
+                          });
+        }
+
+        util::sref<Function const> const func;
+        ReadSet reads;
+        int outermost_read;
+    };
+
+}
+
+static bool scalarSignature(util::sref<Function const> func)
+{
+    return func->return_type->isScalar()
+        && !func->params.empty()
+        && std::all_of(func->params.begin()
+                     , func->params.end()
+                     , [&](Function::ParamInfo const& param)
+                       {
+                           return param.type->isScalar();
+                       });
+}
+
+/*
+ * Walks the functions reachable through calls from pending, directly or not,
+ * and tells if every one of them is known and passes check.
+ */
+template <typename _Check>
+static bool allReached(std::vector<int> pending
+                     , std::map<int, util::sptr<FuncEffects>> const& effects
+                     , _Check check)
+{
+    std::set<int> reached;
+    while (!pending.empty()) {
+        int sn = pending.back();
+        pending.pop_back();
+        if (!reached.insert(sn).second) {
+            continue;
+        }
+        auto callee = effects.find(sn);
+        if (effects.end() == callee || !check(*callee->second)) {
+            return false;
+        }
+        std::for_each(callee->second->reads.calls.begin()
+                    , callee->second->reads.calls.end()
+                    , [&](util::sref<Call const> call)
+                      {
+                          pending.push_back(call->call_sn.n);
+                      });
+    }
+    return true;
+}
+
+static std::map<int, util::sptr<FuncEffects>> funcEffects(
+                                    std::vector<util::sptr<Function const>> const& funcs)
+{
+    std::map<int, util::sptr<FuncEffects>> effects;
+    std::for_each(funcs.begin()
+                , funcs.end()
+                , [&](util::sptr<Function const> const& func)
+                  {
+                      effects.insert(std::make_pair(
+                                func->call_sn.n, util::mkptr(new FuncEffects(*func))));
+                  });
+    return std::move(effects);
+}
+
+/*
+ * A function is pure if neither it nor any function it calls, directly or not,
+ * writes or reads a frame outside its own call, that is a slot at a level
+ * lower than its own.
+ */
+static bool isPure(util::sref<Function const> func
+                 , std::map<int, util::sptr<FuncEffects>> const& effects)
+{
+    return allReached(std::vector<int>(1, func->call_sn.n)
+                    , effects
+                    , [&](util::sref<FuncEffects const> callee)
+                      {
+                          return !callee->reads.writes && callee->outermost_read >= func->level;
+                      });
+}
+
+void inst::markMemoizedFuncs(std::vector<util::sptr<Function const>> const& funcs)
+{
+    if (!misc::options::get().memoize) {
+        return;
+    }
+    std::map<int, util::sptr<FuncEffects>> effects(funcEffects(funcs));
+    std::for_each(funcs.begin()
+                , funcs.end()
+                , [&](util::sptr<Function const> const& func)
+                  {
+                      func->memoized = scalarSignature(*func) && isPure(*func, effects);
+                  });
+    std::for_each(effects.begin()
+                , effects.end()
+                , [&](std::pair<int const, util::sptr<FuncEffects>> const& func_effects)
+                  {
+                      std::for_each(func_effects.second->reads.calls.begin()
+                                  , func_effects.second->reads.calls.end()
+                                  , [&](util::sref<Call const> call)
+                                    {
+                                        auto callee = effects.find(call->call_sn.n);
+                                        call->memoized = effects.end() != callee
+                                                      && callee->second->func->memoized;
+                                    });
+                  });
+}
+
+/*
+ * A stage may write if it writes itself or calls a function that writes,
+ * directly or not.  Such a stage ends its fused loop, so all of its writes
+ * come before any write of the stages after it, as if each stage built its
+ * own list.
+ */
+void inst::markWritingStages(std::vector<util::sptr<Function const>> const& funcs)
+{
+    std::map<int, util::sptr<FuncEffects>> effects(funcEffects(funcs));
+    std::for_each(effects.begin()
+                , effects.end()
+                , [&](std::pair<int const, util::sptr<FuncEffects>> const& func_effects)
+                  {
+                      std::for_each(func_effects.second->reads.pipes.begin()
+                                  , func_effects.second->reads.pipes.end()
+                                  , [&](util::sref<PipeBase const> pipe)
+                                    {
+                                        ReadSet stage_reads;
+                                        pipe->expr->collectReads(stage_reads);
+                                        std::vector<int> callees;
+                                        std::for_each(stage_reads.calls.begin()
+                                                    , stage_reads.calls.end()
+                                                    , [&](util::sref<Call const> call)
+                                                      {
+                                                          callees.push_back(call->call_sn.n);
+                                                      });
+                                        pipe->may_write = stage_reads.writes
+                                            || !allReached(callees
+                                                         , effects
+                                                         , [&](util::sref<FuncEffects const> callee)
+                                                           {
+                                                               return !callee->reads.writes;
+                                                           });
+                                    });
+                  });
+}
@@ -0,0 +1,17 @@
+#ifndef __STEKIN_INSTANCE_MEMOIZE_H__
+#define __STEKIN_INSTANCE_MEMOIZE_H__
+
+#include <vector>
+
+#include <util/pointer.h>
+
+#include "fwd-decl.h"
+
+namespace inst {
+
+    void markMemoizedFuncs(std::vector<util::sptr<Function const>> const& funcs);
+    void markWritingStages(std::vector<util::sptr<Function const>> const& funcs);
+
+}
+
+#endif /* __STEKIN_INSTANCE_MEMOIZE_H__ */
@@ -3,3 +3,11 @@
 using namespace inst;
 
 void Expression::writePipeDef(int) const {}
+void Expression::collectReads(ReadSet&) const {}
+
+util::sref<Call const> Expression::callTo(util::serial_num) const
+{
+    return util::sref<Call const>(nullptr);
+}
+
+void Statement::markTailCalls(util::sref<Function const>) const {}
@@ -1,21 +1,39 @@
 #ifndef __STEKIN_INSTANCE_NODE_BASE_H__
 #define __STEKIN_INSTANCE_NODE_BASE_H__
 
+#include <util/arena.h>
+#include <util/pointer.h>
+#include <util/sn.h>
+
+#include "fwd-decl.h"
+
 namespace inst {
 
-    struct Expression {
+    struct NodeArenaTag;
+    typedef util::arena_allocated<NodeArenaTag> ArenaNode;
+
+    struct Expression
+        : public ArenaNode
+    {
         Expression() {}
         virtual ~Expression() {}
 
         virtual void write() const = 0;
         virtual void writePipeDef(int level) const;
+        virtual void collectReads(ReadSet& reads) const;
+        virtual util::sref<Call const> callTo(util::serial_num func_sn) const;
     };
 
-    struct Statement {
+    struct Statement
+        : public ArenaNode
+    {
         Statement() {}
         virtual ~Statement() {}
 
         virtual void write() const = 0;
+        virtual void collectReads(ReadSet& reads) const = 0;
+        virtual void markLastReads(LiveSlots& live) const = 0;
+        virtual void markTailCalls(util::sref<Function const> func) const;
     };
 
 }
@@ -0,0 +1,95 @@
+#include <algorithm>
+#include <map>
+#include <set>
+
+#include <misc/options.h>
+
+#include "outer-levels.h"
+#include "last-read.h"
+#include "function.h"
+#include "expr-nodes.h"
+
+using namespace inst;
+
+namespace {
+
+    struct OuterReads {
+        explicit OuterReads(util::sref<Function const> f)
+            : func(f)
+        {
+            func->body->collectReads(reads);
+            std::for_each(reads.slots.begin()
+                        , reads.slots.end()
+                        , [&](Address const& address)
+                          {
+                              if (address.level < func->level) {
+                                  levels.insert(address.level);
+                              }
+                          });
+        }
+
+        util::sref<Function const> const func;
+        ReadSet reads;
+        std::set<int> levels;
+    };
+
+}
+
+/*
+ * A function keeps the base of an outer level if it reads a slot there, or if
+ * a function it calls keeps it, since the callee takes its bases from the
+ * caller.  Levels are added until no function gains any.
+ */
+void inst::markOuterLevels(std::vector<util::sptr<Function const>> const& funcs)
+{
+    if (!misc::options::get().compact_bases) {
+        return;
+    }
+    std::map<int, util::sptr<OuterReads>> outer_reads;
+    std::for_each(funcs.begin()
+                , funcs.end()
+                , [&](util::sptr<Function const> const& func)
+                  {
+                      outer_reads.insert(std::make_pair(
+                                func->call_sn.n, util::mkptr(new OuterReads(*func))));
+                  });
+
+    bool changed = true;
+    while (changed) {
+        changed = false;
+        std::for_each(outer_reads.begin()
+                    , outer_reads.end()
+                    , [&](std::pair<int const, util::sptr<OuterReads>> const& caller)
+                      {
+                          int const level = caller.second->func->level;
+                          std::set<int>& levels = caller.second->levels;
+                          std::for_each(caller.second->reads.calls.begin()
+                                      , caller.second->reads.calls.end()
+                                      , [&](util::sref<Call const> call)
+                                        {
+                                            auto callee = outer_reads.find(call->call_sn.n);
+                                            if (outer_reads.end() == callee) {
+                                                return;
+                                            }
+                                            std::for_each(callee->second->levels.begin()
+                                                        , callee->second->levels.end()
+                                                        , [&](int callee_level)
+                                                          {
+                                                              if (callee_level < level
+                                                                      && levels.insert(callee_level).second)
+                                                              {
+                                                                  changed = true;
+                                                              }
+                                                          });
+                                        });
+                      });
+    }
+
+    std::for_each(outer_reads.begin()
+                , outer_reads.end()
+                , [&](std::pair<int const, util::sptr<OuterReads>> const& func_reads)
+                  {
+                      func_reads.second->func->outer_levels.assign(
+                                func_reads.second->levels.begin(), func_reads.second->levels.end());
+                  });
+}
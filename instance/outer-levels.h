@@ -0,0 +1,16 @@
+#ifndef __STEKIN_INSTANCE_OUTER_LEVELS_H__
+#define __STEKIN_INSTANCE_OUTER_LEVELS_H__
+
+#include <vector>
+
+#include <util/pointer.h>
+
+#include "fwd-decl.h"
+
+namespace inst {
+
+    void markOuterLevels(std::vector<util::sptr<Function const>> const& funcs);
+
+}
+
+#endif /* __STEKIN_INSTANCE_OUTER_LEVELS_H__ */
@@ -0,0 +1,99 @@
+#include <algorithm>
+#include <map>
+
+#include <misc/options.h>
+
+#include "plain-func.h"
+#include "last-read.h"
+#include "function.h"
+#include "expr-nodes.h"
+
+using namespace inst;
+
+static bool scalarFrame(util::sref<Function const> func)
+{
+    return func->return_type->isScalar()
+        && std::all_of(func->params.begin()
+                     , func->params.end()
+                     , [&](Function::ParamInfo const& param)
+                       {
+                           return param.type->isScalar();
+                       })
+        && std::all_of(func->frame_slots.begin()
+                     , func->frame_slots.end()
+                     , [&](Function::SlotInfo const& slot)
+                       {
+                           return 0 == slot.size || slot.type->isScalar();
+                       });
+}
+
+static bool ownFrameOnly(int level, ReadSet const& reads)
+{
+    return !reads.uses_frame
+        && std::all_of(reads.slots.begin()
+                     , reads.slots.end()
+                     , [&](Address const& address)
+                       {
+                           return level == address.level;
+                       });
+}
+
+/*
+ * A function is plain if its frame holds only scalars, it reads no other frame
+ * and builds no list or closure, and all functions it calls are plain as well.
+ * It is then written as a C++ function taking its arguments by value, with its
+ * frame as a local, instead of a struct constructed with the frame bases.
+ */
+void inst::markPlainFuncs(std::vector<util::sptr<Function const>> const& funcs)
+{
+    if (!misc::options::get().plain_func) {
+        return;
+    }
+    std::map<int, ReadSet> candidates;
+    std::for_each(funcs.begin()
+                , funcs.end()
+                , [&](util::sptr<Function const> const& func)
+                  {
+                      ReadSet reads;
+                      func->body->collectReads(reads);
+                      if (scalarFrame(*func) && ownFrameOnly(func->level, reads)) {
+                          candidates.insert(std::make_pair(func->call_sn.n, reads));
+                      }
+                  });
+
+    bool changed = true;
+    while (changed) {
+        changed = false;
+        for (auto candidate = candidates.begin(); candidates.end() != candidate;) {
+            ReadSet const& reads = candidate->second;
+            if (std::all_of(reads.calls.begin()
+                          , reads.calls.end()
+                          , [&](util::sref<Call const> call)
+                            {
+                                return candidates.end() != candidates.find(call->call_sn.n);
+                            }))
+            {
+                ++candidate;
+            } else {
+                candidates.erase(candidate++);
+                changed = true;
+            }
+        }
+    }
+
+    std::for_each(funcs.begin()
+                , funcs.end()
+                , [&](util::sptr<Function const> const& func)
+                  {
+                      func->plain = candidates.end() != candidates.find(func->call_sn.n);
+                      ReadSet reads;
+                      func->body->collectReads(reads);
+                      std::for_each(reads.calls.begin()
+                                  , reads.calls.end()
+                                  , [&](util::sref<Call const> call)
+                                    {
+                                        call->plain = candidates.end()
+                                                   != candidates.find(call->call_sn.n);
+                                    });
+                  });
+}
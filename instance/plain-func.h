@@ -0,0 +1,16 @@
+#ifndef __STEKIN_INSTANCE_PLAIN_FUNCTION_H__
+#define __STEKIN_INSTANCE_PLAIN_FUNCTION_H__
+
+#include <vector>
+
+#include <util/pointer.h>
+
+#include "fwd-decl.h"
+
+namespace inst {
+
+    void markPlainFuncs(std::vector<util::sptr<Function const>> const& funcs);
+
+}
+
+#endif /* __STEKIN_INSTANCE_PLAIN_FUNCTION_H__ */
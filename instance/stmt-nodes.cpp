@@ -4,6 +4,9 @@
 #include <output/expr-writer.h>
 
 #include "stmt-nodes.h"
+#include "expr-nodes.h"
+#include "function.h"
+#include "last-read.h"
 
 using namespace inst;
 
@@ -34,12 +37,15 @@ void Initialization::write() const
     init->write();
     output::endExpr();
     output::endOfStatement();
-    type->writeResEntry(offset);
 }
 
 void Return::write() const
 {
     ret_val->writePipeDef(level);
+    if (tail_call.not_nul()) {
+        tail_call_func->writeTailCall(tail_call->args);
+        return;
+    }
     output::kwReturn();
     ret_val->write();
     output::endOfStatement();
@@ -49,3 +55,81 @@ void ReturnNothing::write() const
 {
     output::returnNothing();
 }
+
+void Arithmetics::collectReads(ReadSet& reads) const
+{
+    expr->collectReads(reads);
+}
+
+void Branch::collectReads(ReadSet& reads) const
+{
+    predicate->collectReads(reads);
+    consequence->collectReads(reads);
+    alternative->collectReads(reads);
+}
+
+void Initialization::collectReads(ReadSet& reads) const
+{
+    init->collectReads(reads);
+}
+
+void Return::collectReads(ReadSet& reads) const
+{
+    ret_val->collectReads(reads);
+}
+
+void ReturnNothing::collectReads(ReadSet&) const {}
+
+void Arithmetics::markLastReads(LiveSlots& live) const
+{
+    ReadSet reads;
+    expr->collectReads(reads);
+    live.statementReads(reads);
+}
+
+void Branch::markLastReads(LiveSlots& live) const
+{
+    LiveSlots alternative_live(live);
+    consequence->markLastReads(live);
+    alternative->markLastReads(alternative_live);
+    live.join(alternative_live);
+    ReadSet reads;
+    predicate->collectReads(reads);
+    live.statementReads(reads);
+}
+
+void Initialization::markLastReads(LiveSlots& live) const
+{
+    live.define(offset);
+    ReadSet reads;
+    init->collectReads(reads);
+    live.statementReads(reads);
+}
+
+void Return::markLastReads(LiveSlots& live) const
+{
+    live.clear();
+    ReadSet reads;
+    ret_val->collectReads(reads);
+    live.statementReads(reads);
+}
+
+void ReturnNothing::markLastReads(LiveSlots& live) const
+{
+    live.clear();
+}
+
+void Branch::markTailCalls(util::sref<Function const> func) const
+{
+    consequence->markTailCalls(func);
+    alternative->markTailCalls(func);
+}
+
+void Return::markTailCalls(util::sref<Function const> func) const
+{
+    tail_call = ret_val->callTo(func->call_sn);
+    if (tail_call.not_nul()) {
+        tail_call_func = func;
+        func->self_tail_call = true;
+    }
+}
@@ -17,6 +17,8 @@ namespace inst {
         {}
 
         void write() const;
+        void collectReads(ReadSet& reads) const;
+        void markLastReads(LiveSlots& live) const;
 
         int const level;
         util::sptr<Expression const> const expr;
@@ -36,6 +38,9 @@ namespace inst {
         {}
 
         void write() const;
+        void collectReads(ReadSet& reads) const;
+        void markLastReads(LiveSlots& live) const;
+        void markTailCalls(util::sref<Function const> func) const;
 
         int const level;
         util::sptr<Expression const> const predicate;
@@ -54,6 +59,8 @@ namespace inst {
         {}
 
         void write() const;
+        void collectReads(ReadSet& reads) const;
+        void markLastReads(LiveSlots& live) const;
 
         int const level;
         int const offset;
@@ -67,18 +74,27 @@ namespace inst {
         explicit Return(int l, util::sptr<Expression const> r)
             : level(l)
             , ret_val(std::move(r))
+            , tail_call(nullptr)
+            , tail_call_func(nullptr)
         {}
 
         void write() const;
+        void collectReads(ReadSet& reads) const;
+        void markLastReads(LiveSlots& live) const;
+        void markTailCalls(util::sref<Function const> func) const;
 
         int const level;
         util::sptr<Expression const> const ret_val;
+        mutable util::sref<Call const> tail_call;
+        mutable util::sref<Function const> tail_call_func;
     };
 
     struct ReturnNothing
         : public Statement
     {
         void write() const;
+        void collectReads(ReadSet& reads) const;
+        void markLastReads(LiveSlots& live) const;
     };
 
 }
@@ -13,18 +13,32 @@ using namespace output;
 void output::writeFuncDecl(std::string const& return_type_name
                          , util::serial_num
                          , std::vector<util::sptr<StackVarRec const>> const& var_recs
+                         , std::vector<FrameSlot> const& frame_slots
                          , int level
+                         , std::vector<int> const&
                          , int stack_size
-                         , int res_entry_size)
+                         , std::vector<FrameSlot> const& res_slots)
 {
     DataTree::actualOne()(FUNC_DECL_BEGIN, return_type_name, level, stack_size);
-    DataTree::actualOne()(FUNC_RES_ENTRY, res_entry_size);
+    DataTree::actualOne()(FUNC_RES_ENTRY, int(res_slots.size()));
     std::for_each(var_recs.begin()
                 , var_recs.end()
                 , [&](util::sptr<StackVarRec const> const& var)
                   {
                       DataTree::actualOne()(PARAMETER, var->type, var->level, var->offset);
                   });
+    std::for_each(frame_slots.begin()
+                , frame_slots.end()
+                , [&](FrameSlot const& slot)
+                  {
+                      DataTree::actualOne()(FRAME_SLOT, slot.type, slot.size, slot.offset);
+                  });
+    std::for_each(res_slots.begin()
+                , res_slots.end()
+                , [&](FrameSlot const& slot)
+                  {
+                      DataTree::actualOne()(RES_SLOT, slot.type, slot.offset);
+                  });
     DataTree::actualOne()(FUNC_DECL_END);
 }
 
@@ -33,11 +47,109 @@ void output::writeFuncImpl(std::string const& return_type_name, util::serial_num
     DataTree::actualOne()(FUNC_DEF, return_type_name);
 }
 
+void output::writeFuncImplEnd(std::string const& return_type_name)
+{
+    DataTree::actualOne()(FUNC_DEF_END, return_type_name);
+}
+
+void output::writePlainFuncDecl(std::string const& return_type_name
+                              , util::serial_num
+                              , std::vector<util::sptr<StackVarRec const>> const& var_recs
+                              , std::vector<FrameSlot> const&
+                              , int stack_size)
+{
+    DataTree::actualOne()(PLAIN_FUNC_DECL, return_type_name, 0, stack_size);
+    std::for_each(var_recs.begin()
+                , var_recs.end()
+                , [&](util::sptr<StackVarRec const> const& var)
+                  {
+                      DataTree::actualOne()(PARAMETER, var->type, var->level, var->offset);
+                  });
+}
+
+void output::writePlainFuncImpl(std::string const& return_type_name
+                              , util::serial_num
+                              , std::vector<util::sptr<StackVarRec const>> const&
+                              , int level)
+{
+    DataTree::actualOne()(PLAIN_FUNC_DEF, return_type_name, level, 0);
+}
+
+void output::writeTailCallEntry()
+{
+    DataTree::actualOne()(TAIL_CALL_ENTRY);
+}
+
+void output::tailCallBegin()
+{
+    DataTree::actualOne()(TAIL_CALL_BEGIN);
+}
+
+void output::tailCallArgBegin(int index, std::string const& type_exported_name)
+{
+    DataTree::actualOne()(TAIL_CALL_ARG_BEGIN, type_exported_name, index);
+}
+
+void output::tailCallArgEnd()
+{
+    DataTree::actualOne()(TAIL_CALL_ARG_END);
+}
+
+void output::tailCallEnd(std::vector<util::sptr<StackVarRec const>> const& var_recs
+                       , std::vector<FrameSlot> const& res_slots)
+{
+    DataTree::actualOne()(TAIL_CALL_END);
+    std::for_each(res_slots.begin()
+                , res_slots.end()
+                , [&](FrameSlot const& slot)
+                  {
+                      DataTree::actualOne()(RES_SLOT, slot.type, slot.offset);
+                  });
+    std::for_each(var_recs.begin()
+                , var_recs.end()
+                , [&](util::sptr<StackVarRec const> const& var)
+                  {
+                      DataTree::actualOne()(PARAMETER, var->type, var->level, var->offset);
+                  });
+}
+
 void output::writeCallBegin(util::serial_num)
 {
     DataTree::actualOne()(CALL_BEGIN);
 }
 
+void output::writeMemoTable(std::string const& return_type_name
+                          , util::serial_num
+                          , std::vector<util::sptr<StackVarRec const>> const& var_recs)
+{
+    DataTree::actualOne()(MEMO_TABLE, return_type_name, int(var_recs.size()));
+}
+
+void output::writeMemoCallBegin(util::serial_num)
+{
+    DataTree::actualOne()(MEMO_CALL_BEGIN);
+}
+
+void output::writeMemoCallEnd()
+{
+    DataTree::actualOne()(MEMO_CALL_END);
+}
+
+void output::writePlainCallBegin(util::serial_num)
+{
+    DataTree::actualOne()(PLAIN_CALL_BEGIN);
+}
+
+void output::writePlainCallEnd()
+{
+    DataTree::actualOne()(PLAIN_CALL_END);
+}
+
+void output::writePlainMemoCallBegin(util::serial_num)
+{
+    DataTree::actualOne()(PLAIN_MEMO_CALL_BEGIN);
+}
+
 void output::writeArgSeparator()
 {
     DataTree::actualOne()(ARG_SEPARATOR);
@@ -58,29 +170,118 @@ void output::funcReferenceNextVariable(int self_offset, util::sptr<StackVarRec c
     DataTree::actualOne()(FUNC_REF_NEXT_VAR, rec->type, rec->level, rec->offset, self_offset);
 }
 
-void output::pipeMapBegin(util::id pipe_id
-                        , int level
-                        , std::string const& src_member_type
-                        , std::string const& dst_member_type)
+void output::pipelineBegin(util::id
+                         , std::string const& src_member_type
+                         , std::string const& dst_member_type
+                         , bool parallel)
+{
+    DataTree::actualOne()(PIPELINE_BEGIN, src_member_type);
+    DataTree::actualOne()(PIPELINE_BEGIN, dst_member_type, int(parallel));
+}
+
+void output::pipelineLoopBegin(std::string const& src_member_type, bool index_read)
+{
+    DataTree::actualOne()(PIPELINE_LOOP_BEGIN, src_member_type, int(index_read));
+}
+
+void output::pipelineLoopEnd()
+{
+    DataTree::actualOne()(PIPELINE_LOOP_END);
+}
+
+void output::pipelineEnd()
+{
+    DataTree::actualOne()(PIPELINE_END);
+}
+
+void output::pipeMapBegin(util::id, std::string const& dst_member_type)
 {
-    DataTree::actualOne()(PIPE_MAP_BEGIN, level, pipe_id.str());
-    DataTree::actualOne()(PIPE_MAP_BEGIN, src_member_type);
     DataTree::actualOne()(PIPE_MAP_BEGIN, dst_member_type);
 }
 
-void output::pipeMapEnd()
+void output::pipeMapEnd(util::id, std::string const& dst_member_type)
+{
+    DataTree::actualOne()(PIPE_MAP_END, dst_member_type);
+}
+
+void output::pipeFilterCounter(util::id)
+{
+    DataTree::actualOne()(PIPE_FILTER_COUNTER);
+}
+
+void output::pipeFilterBegin()
+{
+    DataTree::actualOne()(PIPE_FILTER_BEGIN);
+}
+
+void output::pipeFilterEnd(util::id, bool index_read)
+{
+    DataTree::actualOne()(PIPE_FILTER_END, int(index_read));
+}
+
+void output::pipeStageEnd()
+{
+    DataTree::actualOne()(PIPE_STAGE_END);
+}
+
+void output::pipeKernelBegin(util::id, std::string const& member_type, bool parallel)
 {
-    DataTree::actualOne()(PIPE_MAP_END);
+    DataTree::actualOne()(PIPE_KERNEL_BEGIN, member_type, int(parallel));
 }
 
-void output::pipeFilterBegin(util::id, int level, std::string const& member_type)
+void output::pipeKernelInvariantBegin(int index, std::string const& member_type)
 {
-    DataTree::actualOne()(PIPE_FILTER_BEGIN, level, member_type);
+    DataTree::actualOne()(PIPE_KERNEL_INVARIANT_BEGIN, member_type, index);
 }
 
-void output::pipeFilterEnd()
+void output::pipeKernelInvariantEnd(int index, std::string const& member_type)
 {
-    DataTree::actualOne()(PIPE_FILTER_END);
+    DataTree::actualOne()(PIPE_KERNEL_INVARIANT_END, member_type, index);
+}
+
+void output::pipeKernelVectorLoopBegin(std::string const& member_type, bool index_read)
+{
+    DataTree::actualOne()(PIPE_KERNEL_VECTOR_LOOP_BEGIN, member_type, int(index_read));
+}
+
+void output::pipeKernelVectorInvariant(int index, std::string const& member_type)
+{
+    DataTree::actualOne()(PIPE_KERNEL_VECTOR_INVARIANT, member_type, index);
+}
+
+void output::pipeKernelVectorLoopEnd(std::string const& member_type)
+{
+    DataTree::actualOne()(PIPE_KERNEL_VECTOR_LOOP_END, member_type);
+}
+
+void output::pipeKernelScalarLoopBegin(std::string const& member_type, bool index_read)
+{
+    DataTree::actualOne()(PIPE_KERNEL_SCALAR_LOOP_BEGIN, member_type, int(index_read));
+}
+
+void output::pipeKernelScalarInvariant(int index, std::string const& member_type)
+{
+    DataTree::actualOne()(PIPE_KERNEL_SCALAR_INVARIANT, member_type, index);
+}
+
+void output::pipeKernelScalarLoopEnd()
+{
+    DataTree::actualOne()(PIPE_KERNEL_SCALAR_LOOP_END);
+}
+
+void output::pipeKernelLoopClose()
+{
+    DataTree::actualOne()(PIPE_KERNEL_LOOP_CLOSE);
+}
+
+void output::pipeKernelEnd()
+{
+    DataTree::actualOne()(PIPE_KERNEL_END);
+}
+
+void output::pipeKernelInvariant(int index)
+{
+    DataTree::actualOne()(PIPE_KERNEL_INVARIANT, index);
 }
 
 void output::pipeBegin(util::id pipe_id)
@@ -118,14 +319,24 @@ void output::initThisLevel(int offset, std::string const& name)
     DataTree::actualOne()(INITIALIZE_THIS_LEVEL, name, offset);
 }
 
-void output::addResEntry(int offset)
+void output::refLevel(int offset, int level, std::string const& type_name)
 {
-    DataTree::actualOne()(ADD_RES_ENTRY, offset);
+    DataTree::actualOne()(REFERENCE, type_name, level, offset);
 }
 
-void output::refLevel(int offset, int level, std::string const& type_name)
+void output::moveRefLevel(int offset, int level, std::string const& type_name)
 {
-    DataTree::actualOne()(REFERENCE, type_name, level, offset);
+    DataTree::actualOne()(MOVE_REFERENCE, type_name, level, offset);
+}
+
+void output::refThisFrame(int offset)
+{
+    DataTree::actualOne()(FRAME_REFERENCE, offset);
+}
+
+void output::moveRefThisFrame(int offset)
+{
+    DataTree::actualOne()(MOVE_FRAME_REFERENCE, offset);
 }
 
 void output::writeInt(platform::int_type value)
@@ -168,6 +379,28 @@ void output::listEnd()
     DataTree::actualOne()(LIST_END);
 }
 
+void output::staticListBegin(util::id list_id, std::string const& member_type_exported_name)
+{
+    DataTree::actualOne()(STATIC_LIST_BEGIN, list_id.str());
+    DataTree::actualOne()(STATIC_LIST_BEGIN, member_type_exported_name);
+}
+
+void output::staticListMemberEnd()
+{
+    DataTree::actualOne()(STATIC_LIST_MEMBER_END);
+}
+
+void output::staticListEnd(util::id list_id, std::string const& member_type_exported_name, int size)
+{
+    DataTree::actualOne()(STATIC_LIST_END, list_id.str());
+    DataTree::actualOne()(STATIC_LIST_END, member_type_exported_name, size);
+}
+
+void output::staticList(util::id list_id)
+{
+    DataTree::actualOne()(STATIC_LIST, list_id.str());
+}
+
 void output::listAppendBegin()
 {
     DataTree::actualOne()(LIST_APPEND_BEGIN);
@@ -178,6 +411,21 @@ void output::listAppendEnd()
     DataTree::actualOne()(LIST_APPEND_END);
 }
 
+void output::listSliceBegin()
+{
+    DataTree::actualOne()(LIST_SLICE_BEGIN);
+}
+
+void output::listSliceBound(std::string const& op)
+{
+    DataTree::actualOne()(LIST_SLICE_BOUND, op);
+}
+
+void output::listSliceEnd()
+{
+    DataTree::actualOne()(LIST_SLICE_END);
+}
+
 void output::beginExpr()
 {
     DataTree::actualOne()(EXPRESSION_BEGIN);
@@ -233,16 +481,6 @@ void output::memberCallEnd()
     DataTree::actualOne()(MEMBER_CALL_END);
 }
 
-std::string Parameter::resEntry() const
-{
-    return PARAM + util::str(offset);
-}
-
-std::string ResourceParam::resEntry() const
-{
-    return RES_PARAM + util::str(offset);
-}
-
 std::string output::formFuncReferenceType(int size)
 {
     return util::str(size);
@@ -253,6 +491,11 @@ std::string output::formType(std::string const& name)
     return name;
 }
 
+std::string output::formSimdType(std::string const& member_type)
+{
+    return "simd [" + member_type + ']';
+}
+
 std::string output::formListType(std::string const& name)
 {
     return "list [" + name + ']';
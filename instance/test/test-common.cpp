@@ -1,4 +1,8 @@
 #include "test-common.h"
+#include "../function.h"
+#include "../expr-nodes.h"
+#include "../block.h"
+#include "../types.h"
 
 using namespace test;
 
@@ -65,13 +69,20 @@ std::ostream& operator<<(std::ostream& os, InstanceData const& data)
     return os;
 }
 
-std::string const test::PARAM("parameter: ");
-std::string const test::RES_PARAM("resource parameter: ");
 
 NodeType const test::FUNC_DECL_BEGIN("func declaration begin");
 NodeType const test::FUNC_DECL_END("func declaration end");
 NodeType const test::FUNC_DEF("func definition");
+NodeType const test::FUNC_DEF_END("func definition end");
+NodeType const test::PLAIN_FUNC_DECL("plain func decl");
+NodeType const test::PLAIN_FUNC_DEF("plain func def");
+NodeType const test::TAIL_CALL_ENTRY("tail call entry");
+NodeType const test::TAIL_CALL_BEGIN("tail call begin");
+NodeType const test::TAIL_CALL_ARG_BEGIN("tail call argument begin");
+NodeType const test::TAIL_CALL_ARG_END("tail call argument end");
+NodeType const test::TAIL_CALL_END("tail call end");
 NodeType const test::PARAMETER("parameter");
+NodeType const test::FRAME_SLOT("frame slot");
 
 NodeType const test::BLOCK_BEGIN("block begin");
 NodeType const test::BLOCK_END("block end");
@@ -84,14 +95,40 @@ NodeType const test::EMPTY_LIST("empty list");
 NodeType const test::LIST_BEGIN("list begin");
 NodeType const test::LIST_NEXT_MEMBER("list next member");
 NodeType const test::LIST_END("list end");
+NodeType const test::STATIC_LIST_BEGIN("static list begin");
+NodeType const test::STATIC_LIST_MEMBER_END("static list member end");
+NodeType const test::STATIC_LIST_END("static list end");
+NodeType const test::STATIC_LIST("static list");
 
 NodeType const test::LIST_APPEND_BEGIN("list append begin");
 NodeType const test::LIST_APPEND_END("list append end");
 
+NodeType const test::LIST_SLICE_BEGIN("list slice begin");
+NodeType const test::LIST_SLICE_BOUND("list slice bound");
+NodeType const test::LIST_SLICE_END("list slice end");
+
+NodeType const test::PIPELINE_BEGIN("pipeline begin");
+NodeType const test::PIPELINE_LOOP_BEGIN("pipeline loop begin");
+NodeType const test::PIPELINE_LOOP_END("pipeline loop end");
+NodeType const test::PIPELINE_END("pipeline end");
 NodeType const test::PIPE_MAP_BEGIN("pipe map begin");
 NodeType const test::PIPE_MAP_END("pipe map end");
+NodeType const test::PIPE_KERNEL_BEGIN("pipe kernel begin");
+NodeType const test::PIPE_KERNEL_INVARIANT_BEGIN("pipe kernel invariant begin");
+NodeType const test::PIPE_KERNEL_INVARIANT_END("pipe kernel invariant end");
+NodeType const test::PIPE_KERNEL_VECTOR_LOOP_BEGIN("pipe kernel vector loop begin");
+NodeType const test::PIPE_KERNEL_VECTOR_INVARIANT("pipe kernel vector invariant");
+NodeType const test::PIPE_KERNEL_VECTOR_LOOP_END("pipe kernel vector loop end");
+NodeType const test::PIPE_KERNEL_SCALAR_LOOP_BEGIN("pipe kernel scalar loop begin");
+NodeType const test::PIPE_KERNEL_SCALAR_INVARIANT("pipe kernel scalar invariant");
+NodeType const test::PIPE_KERNEL_SCALAR_LOOP_END("pipe kernel scalar loop end");
+NodeType const test::PIPE_KERNEL_LOOP_CLOSE("pipe kernel loop close");
+NodeType const test::PIPE_KERNEL_END("pipe kernel end");
+NodeType const test::PIPE_KERNEL_INVARIANT("pipe kernel invariant");
 NodeType const test::PIPE_FILTER_BEGIN("pipe filter begin");
 NodeType const test::PIPE_FILTER_END("pipe filter end");
+NodeType const test::PIPE_FILTER_COUNTER("pipe filter counter");
+NodeType const test::PIPE_STAGE_END("pipe stage end");
 NodeType const test::PIPE_BEGIN("pipe begin");
 NodeType const test::PIPE_END("pipe end");
 NodeType const test::PIPE_ELEMENT("pipe element");
@@ -99,13 +136,22 @@ NodeType const test::PIPE_INDEX("pipe index");
 
 NodeType const test::INITIALIZE_THIS_LEVEL("initialize this level");
 NodeType const test::REFERENCE("reference");
+NodeType const test::MOVE_REFERENCE("move reference");
+NodeType const test::FRAME_REFERENCE("frame reference");
+NodeType const test::MOVE_FRAME_REFERENCE("move frame reference");
 NodeType const test::CALL_BEGIN("call begin");
 NodeType const test::CALL_END("call end");
+NodeType const test::MEMO_CALL_BEGIN("memoized call begin");
+NodeType const test::MEMO_CALL_END("memoized call end");
+NodeType const test::PLAIN_CALL_BEGIN("plain call begin");
+NodeType const test::PLAIN_CALL_END("plain call end");
+NodeType const test::PLAIN_MEMO_CALL_BEGIN("plain memoized call begin");
+NodeType const test::MEMO_TABLE("memo table");
 NodeType const test::ARG_SEPARATOR("argument separator");
 NodeType const test::FUNC_REFERENCE("func reference");
 NodeType const test::FUNC_REF_NEXT_VAR("func reference next variable");
 NodeType const test::FUNC_RES_ENTRY("func reference resource entry");
-NodeType const test::ADD_RES_ENTRY("add reference resource entry");
+NodeType const test::RES_SLOT("resource slot");
 
 NodeType const test::OPERATOR("operator");
 NodeType const test::EXPRESSION_BEGIN("expression begin");
@@ -126,3 +172,41 @@ void InstanceTest::TearDown()
 {
     DataTree::verify();
 }
+
+util::sptr<inst::Expression const> test::intRef(int level, int offset)
+{
+    return util::mkptr(new inst::Reference(util::mkptr(new inst::IntPrimitive)
+                                         , inst::Address(level, offset)));
+}
+
+util::sptr<inst::Expression const> test::listRef(int level, int offset)
+{
+    return util::mkptr(new inst::Reference(
+                util::mkptr(new inst::ListType(util::mkptr(new inst::IntPrimitive)))
+              , inst::Address(level, offset)));
+}
+
+util::sptr<inst::Expression const> test::call(util::serial_num call_sn
+                                            , util::sptr<inst::Expression const> arg)
+{
+    std::vector<util::sptr<inst::Expression const>> args;
+    args.push_back(std::move(arg));
+    return util::mkptr(new inst::Call(call_sn, std::move(args)));
+}
+
+util::sptr<inst::Function const> test::makeFunc(util::serial_num call_sn
+                                              , int level
+                                              , util::sptr<inst::Block> body)
+{
+    std::list<inst::Function::ParamInfo> params;
+    params.push_back(inst::Function::ParamInfo(util::mkptr(new inst::IntPrimitive)
+                                             , inst::Address(level, 0)));
+    return util::mkptr(new inst::Function(util::mkptr(new inst::IntPrimitive)
+                                        , level
+                                        , 8
+                                        , std::move(params)
+                                        , std::list<inst::Function::SlotInfo>()
+                                        , call_sn
+                                        , std::vector<int>()
+                                        , std::move(body)));
+}
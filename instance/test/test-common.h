@@ -6,6 +6,9 @@
 #include <test/common.h>
 #include <test/data-node.h>
 #include <test/data-trees.h>
+#include <instance/fwd-decl.h>
+#include <util/pointer.h>
+#include <util/sn.h>
 
 namespace test {
 
@@ -67,13 +70,20 @@ namespace test {
         DataTree& operator()(NodeType const& type, int offset);
     };
 
-    extern std::string const PARAM;
-    extern std::string const RES_PARAM;
 
     extern NodeType const FUNC_DECL_BEGIN;
     extern NodeType const FUNC_DECL_END;
     extern NodeType const FUNC_DEF;
+    extern NodeType const FUNC_DEF_END;
+    extern NodeType const PLAIN_FUNC_DECL;
+    extern NodeType const PLAIN_FUNC_DEF;
+    extern NodeType const TAIL_CALL_ENTRY;
+    extern NodeType const TAIL_CALL_BEGIN;
+    extern NodeType const TAIL_CALL_ARG_BEGIN;
+    extern NodeType const TAIL_CALL_ARG_END;
+    extern NodeType const TAIL_CALL_END;
     extern NodeType const PARAMETER;
+    extern NodeType const FRAME_SLOT;
 
     extern NodeType const BLOCK_BEGIN;
     extern NodeType const BLOCK_END;
@@ -86,14 +96,40 @@ namespace test {
     extern NodeType const LIST_BEGIN;
     extern NodeType const LIST_NEXT_MEMBER;
     extern NodeType const LIST_END;
+    extern NodeType const STATIC_LIST_BEGIN;
+    extern NodeType const STATIC_LIST_MEMBER_END;
+    extern NodeType const STATIC_LIST_END;
+    extern NodeType const STATIC_LIST;
 
     extern NodeType const LIST_APPEND_BEGIN;
     extern NodeType const LIST_APPEND_END;
 
+    extern NodeType const LIST_SLICE_BEGIN;
+    extern NodeType const LIST_SLICE_BOUND;
+    extern NodeType const LIST_SLICE_END;
+
+    extern NodeType const PIPELINE_BEGIN;
+    extern NodeType const PIPELINE_LOOP_BEGIN;
+    extern NodeType const PIPELINE_LOOP_END;
+    extern NodeType const PIPELINE_END;
     extern NodeType const PIPE_MAP_BEGIN;
     extern NodeType const PIPE_MAP_END;
+    extern NodeType const PIPE_KERNEL_BEGIN;
+    extern NodeType const PIPE_KERNEL_INVARIANT_BEGIN;
+    extern NodeType const PIPE_KERNEL_INVARIANT_END;
+    extern NodeType const PIPE_KERNEL_VECTOR_LOOP_BEGIN;
+    extern NodeType const PIPE_KERNEL_VECTOR_INVARIANT;
+    extern NodeType const PIPE_KERNEL_VECTOR_LOOP_END;
+    extern NodeType const PIPE_KERNEL_SCALAR_LOOP_BEGIN;
+    extern NodeType const PIPE_KERNEL_SCALAR_INVARIANT;
+    extern NodeType const PIPE_KERNEL_SCALAR_LOOP_END;
+    extern NodeType const PIPE_KERNEL_LOOP_CLOSE;
+    extern NodeType const PIPE_KERNEL_END;
+    extern NodeType const PIPE_KERNEL_INVARIANT;
     extern NodeType const PIPE_FILTER_BEGIN;
     extern NodeType const PIPE_FILTER_END;
+    extern NodeType const PIPE_FILTER_COUNTER;
+    extern NodeType const PIPE_STAGE_END;
     extern NodeType const PIPE_BEGIN;
     extern NodeType const PIPE_END;
     extern NodeType const PIPE_ELEMENT;
@@ -101,13 +137,22 @@ namespace test {
 
     extern NodeType const INITIALIZE_THIS_LEVEL;
     extern NodeType const REFERENCE;
+    extern NodeType const MOVE_REFERENCE;
+    extern NodeType const FRAME_REFERENCE;
+    extern NodeType const MOVE_FRAME_REFERENCE;
     extern NodeType const CALL_BEGIN;
     extern NodeType const CALL_END;
+    extern NodeType const MEMO_CALL_BEGIN;
+    extern NodeType const MEMO_CALL_END;
+    extern NodeType const PLAIN_CALL_BEGIN;
+    extern NodeType const PLAIN_CALL_END;
+    extern NodeType const PLAIN_MEMO_CALL_BEGIN;
+    extern NodeType const MEMO_TABLE;
     extern NodeType const ARG_SEPARATOR;
     extern NodeType const FUNC_REFERENCE;
     extern NodeType const FUNC_REF_NEXT_VAR;
     extern NodeType const FUNC_RES_ENTRY;
-    extern NodeType const ADD_RES_ENTRY;
+    extern NodeType const RES_SLOT;
 
     extern NodeType const OPERATOR;
     extern NodeType const EXPRESSION_BEGIN;
@@ -130,6 +175,16 @@ namespace test {
         void TearDown();
     };
 
+    util::sptr<inst::Expression const> intRef(int level, int offset);
+    util::sptr<inst::Expression const> listRef(int level, int offset);
+    util::sptr<inst::Expression const> call(util::serial_num call_sn
+                                          , util::sptr<inst::Expression const> arg);
+
+    /* an int function with one int parameter at offset 0 of its own level */
+    util::sptr<inst::Function const> makeFunc(util::serial_num call_sn
+                                            , int level
+                                            , util::sptr<inst::Block> body);
+
 }
 
 std::ostream& operator<<(std::ostream& os, test::InstanceData const& data);
@@ -65,6 +65,43 @@ TEST_F(ExprNodesTest, ListLiterals)
     ;
 }
 
+TEST_F(ExprNodesTest, StaticListLiterals)
+{
+    int const literal_pos = 0;
+    util::id const list_id(&literal_pos);
+    inst::StaticListLiteral<platform::int_type> ls0(util::mkptr(new inst::IntPrimitive)
+                                                  , list_id
+                                                  , std::vector<platform::int_type>({ 5, 8 }));
+    ls0.writeDef();
+    ls0.write();
+
+    inst::StaticListLiteral<platform::float_type> ls1(util::mkptr(new inst::FloatPrimitive)
+                                                    , util::id(&ls0)
+                                                    , std::vector<platform::float_type>({ 0.5 }));
+    ls1.writeDef();
+    ls1.write();
+
+    DataTree::expectOne()
+        (STATIC_LIST_BEGIN, list_id.str())
+        (STATIC_LIST_BEGIN, "int")
+            (INTEGER, "5")
+            (STATIC_LIST_MEMBER_END)
+            (INTEGER, "8")
+            (STATIC_LIST_MEMBER_END)
+        (STATIC_LIST_END, list_id.str())
+        (STATIC_LIST_END, "int", 2)
+        (STATIC_LIST, list_id.str())
+
+        (STATIC_LIST_BEGIN, util::id(&ls0).str())
+        (STATIC_LIST_BEGIN, "float")
+            (FLOAT, "0.5")
+            (STATIC_LIST_MEMBER_END)
+        (STATIC_LIST_END, util::id(&ls0).str())
+        (STATIC_LIST_END, "float", 1)
+        (STATIC_LIST, util::id(&ls0).str())
+    ;
+}
+
 TEST_F(ExprNodesTest, Reference)
 {
     inst::Reference r0(util::mkptr(new inst::VoidPrimitive), inst::Address(0, 0));
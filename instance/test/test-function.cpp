@@ -4,6 +4,8 @@
 #include "../function.h"
 #include "../types.h"
 #include "../block.h"
+#include "../stmt-nodes.h"
+#include "../expr-nodes.h"
 
 using namespace test;
 
@@ -15,6 +17,7 @@ TEST_F(FunctionTest, WriteDecl)
                                      , 1
                                      , 0
                                      , std::list<inst::Function::ParamInfo>()
+                                     , std::list<inst::Function::SlotInfo>()
                                      , util::serial_num::next()
                                      , std::vector<int>()
                                      , util::mkptr(new inst::Block));
@@ -29,6 +32,7 @@ TEST_F(FunctionTest, WriteDecl)
                                     , 1
                                     , 0
                                     , std::move(params)
+                                    , std::list<inst::Function::SlotInfo>()
                                     , util::serial_num::next()
                                     , std::vector<int>()
                                     , util::mkptr(new inst::Block));
@@ -53,6 +57,7 @@ TEST_F(FunctionTest, WriteImpl)
                                      , 1
                                      , 0
                                      , std::list<inst::Function::ParamInfo>()
+                                     , std::list<inst::Function::SlotInfo>()
                                      , util::serial_num::next()
                                      , std::vector<int>()
                                      , util::mkptr(new inst::Block));
@@ -67,6 +72,7 @@ TEST_F(FunctionTest, WriteImpl)
                                     , 1
                                     , 0
                                     , std::move(params)
+                                    , std::list<inst::Function::SlotInfo>()
                                     , util::serial_num::next()
                                     , std::vector<int>()
                                     , util::mkptr(new inst::Block));
@@ -76,8 +82,232 @@ TEST_F(FunctionTest, WriteImpl)
         (FUNC_DEF, "void")
             (BLOCK_BEGIN)
             (BLOCK_END)
+        (FUNC_DEF_END, "void")
         (FUNC_DEF, "float")
             (BLOCK_BEGIN)
             (BLOCK_END)
+        (FUNC_DEF_END, "float")
+    ;
+}
+
+TEST_F(FunctionTest, SelfTailCall)
+{
+    util::serial_num call_sn(util::serial_num::next());
+    util::sptr<inst::Block> body(new inst::Block);
+
+    std::vector<util::sptr<inst::Expression const>> args;
+    args.push_back(util::mkptr(new inst::IntLiteral(1)));
+    args.push_back(util::mkptr(new inst::Reference(
+                util::mkptr(new inst::ListType(util::mkptr(new inst::IntPrimitive)))
+              , inst::Address(1, 0))));
+    body->addStmt(util::mkptr(new inst::Return(1, util::mkptr(
+                        new inst::Call(call_sn, std::move(args))))));
+
+    std::list<inst::Function::ParamInfo> params;
+    params.push_back(inst::Function::ParamInfo(util::mkptr(new inst::IntPrimitive)
+                                             , inst::Address(1, 8)));
+    params.push_back(inst::Function::ParamInfo(
+                util::mkptr(new inst::ListType(util::mkptr(new inst::IntPrimitive)))
+              , inst::Address(1, 0)));
+    std::vector<util::sptr<inst::Function const>> funcs;
+    funcs.push_back(util::mkptr(new inst::Function(util::mkptr(new inst::IntPrimitive)
+                                                 , 1
+                                                 , 16
+                                                 , std::move(params)
+                                                 , std::list<inst::Function::SlotInfo>()
+                                                 , call_sn
+                                                 , std::vector<int>()
+                                                 , std::move(body))));
+    inst::markTailCalls(funcs);
+    funcs[0]->writeImpl();
+
+    DataTree::expectOne()
+        (FUNC_DEF, "int")
+        (TAIL_CALL_ENTRY)
+            (BLOCK_BEGIN)
+                (TAIL_CALL_BEGIN)
+                (TAIL_CALL_ARG_BEGIN, "int", 0)
+                    (INTEGER, "1")
+                (TAIL_CALL_ARG_END)
+                (TAIL_CALL_ARG_BEGIN, "list [int]", 1)
+                    (REFERENCE, "list [int]", 1, 0)
+                (TAIL_CALL_ARG_END)
+                (TAIL_CALL_END)
+                    (PARAMETER, "int", 1, 8)
+                    (PARAMETER, "list [int]", 1, 0)
+            (BLOCK_END)
+        (FUNC_DEF_END, "int")
+    ;
+}
+
+TEST_F(FunctionTest, ResSlots)
+{
+    util::serial_num call_sn(util::serial_num::next());
+    util::sptr<inst::Block> body(new inst::Block);
+
+    std::vector<util::sptr<inst::Expression const>> args;
+    args.push_back(util::mkptr(new inst::Reference(
+                util::mkptr(new inst::ListType(util::mkptr(new inst::IntPrimitive)))
+              , inst::Address(1, 0))));
+    body->addStmt(util::mkptr(new inst::Return(1, util::mkptr(
+                        new inst::Call(call_sn, std::move(args))))));
+
+    std::list<inst::Function::ParamInfo> params;
+    params.push_back(inst::Function::ParamInfo(
+                util::mkptr(new inst::ListType(util::mkptr(new inst::IntPrimitive)))
+              , inst::Address(1, 0)));
+    std::list<inst::Function::SlotInfo> slots;
+    slots.push_back(inst::Function::SlotInfo(
+                util::mkptr(new inst::ListType(util::mkptr(new inst::IntPrimitive))), 0, 88));
+    slots.push_back(inst::Function::SlotInfo(util::mkptr(new inst::IntPrimitive), 88, 8));
+    slots.push_back(inst::Function::SlotInfo(
+                util::mkptr(new inst::ListType(util::mkptr(new inst::FloatPrimitive))), 96, 88));
+    std::vector<int> res_entries;
+    res_entries.push_back(0);
+    res_entries.push_back(96);
+    std::vector<util::sptr<inst::Function const>> funcs;
+    funcs.push_back(util::mkptr(new inst::Function(util::mkptr(new inst::IntPrimitive)
+                                                 , 1
+                                                 , 184
+                                                 , std::move(params)
+                                                 , std::move(slots)
+                                                 , call_sn
+                                                 , res_entries
+                                                 , std::move(body))));
+    inst::markTailCalls(funcs);
+    funcs[0]->writeDecl();
+    funcs[0]->writeImpl();
+
+    DataTree::expectOne()
+        (FUNC_DECL_BEGIN, "int", 1, 184)
+        (FUNC_RES_ENTRY, 2)
+            (PARAMETER, "list [int]", 1, 0)
+            (FRAME_SLOT, "list [int]", 88, 0)
+            (FRAME_SLOT, "int", 8, 88)
+            (FRAME_SLOT, "list [float]", 88, 96)
+            (RES_SLOT, "list [int]", 0)
+            (RES_SLOT, "list [float]", 96)
+        (FUNC_DECL_END)
+        (FUNC_DEF, "int")
+        (TAIL_CALL_ENTRY)
+            (BLOCK_BEGIN)
+                (TAIL_CALL_BEGIN)
+                (TAIL_CALL_ARG_BEGIN, "list [int]", 0)
+                    (REFERENCE, "list [int]", 1, 0)
+                (TAIL_CALL_ARG_END)
+                (TAIL_CALL_END)
+                    (RES_SLOT, "list [int]", 0)
+                    (RES_SLOT, "list [float]", 96)
+                    (PARAMETER, "list [int]", 1, 0)
+            (BLOCK_END)
+        (FUNC_DEF_END, "int")
+    ;
+}
+
+TEST_F(FunctionTest, FrameSlots)
+{
+    util::sptr<inst::Block> body(new inst::Block);
+    body->addStmt(util::mkptr(new inst::Arithmetics(1, util::mkptr(
+                        new inst::Reference(util::mkptr(new inst::IntPrimitive)
+                                          , inst::Address(1, 0))))));
+    body->addStmt(util::mkptr(new inst::Arithmetics(1, util::mkptr(
+                        new inst::Reference(util::mkptr(new inst::IntPrimitive)
+                                          , inst::Address(0, 0))))));
+    body->addStmt(util::mkptr(new inst::Arithmetics(1, util::mkptr(
+                        new inst::Reference(util::mkptr(new inst::BoolPrimitive)
+                                          , inst::Address(1, 8))))));
+
+    std::list<inst::Function::SlotInfo> slots;
+    slots.push_back(inst::Function::SlotInfo(util::mkptr(new inst::IntPrimitive), 0, 8));
+    slots.push_back(inst::Function::SlotInfo(util::mkptr(new inst::FloatPrimitive), 8, 8));
+    std::vector<util::sptr<inst::Function const>> funcs;
+    funcs.push_back(util::mkptr(new inst::Function(util::mkptr(new inst::VoidPrimitive)
+                                                 , 1
+                                                 , 16
+                                                 , std::list<inst::Function::ParamInfo>()
+                                                 , std::move(slots)
+                                                 , util::serial_num::next()
+                                                 , std::vector<int>()
+                                                 , std::move(body))));
+    inst::markFrameSlots(funcs);
+    funcs[0]->writeDecl();
+    funcs[0]->writeImpl();
+
+    DataTree::expectOne()
+        (FUNC_DECL_BEGIN, "void", 1, 16)
+        (FUNC_RES_ENTRY, 0)
+            (FRAME_SLOT, "int", 8, 0)
+            (FRAME_SLOT, "float", 8, 8)
+        (FUNC_DECL_END)
+        (FUNC_DEF, "void")
+            (BLOCK_BEGIN)
+                (FRAME_REFERENCE, 0)
+                (END_OF_STATEMENT)
+                (REFERENCE, "int", 0, 0)
+                (END_OF_STATEMENT)
+                (REFERENCE, "bool", 1, 8)
+                (END_OF_STATEMENT)
+            (BLOCK_END)
+        (FUNC_DEF_END, "void")
+    ;
+}
+
+static util::sptr<inst::Function const> funcWithBody(util::sptr<inst::Block> body)
+{
+    return util::mkptr(new inst::Function(util::mkptr(new inst::VoidPrimitive)
+                                        , 1
+                                        , 0
+                                        , std::list<inst::Function::ParamInfo>()
+                                        , std::list<inst::Function::SlotInfo>()
+                                        , util::serial_num::next()
+                                        , std::vector<int>()
+                                        , std::move(body)));
+}
+
+TEST_F(FunctionTest, WriteStaticLists)
+{
+    int const literal_pos[2] = { 0, 0 };
+    util::id const int_list(&literal_pos[0]);
+    util::id const bool_list(&literal_pos[1]);
+
+    util::sptr<inst::Block> body0(new inst::Block);
+    body0->addStmt(util::mkptr(new inst::Arithmetics(1, util::mkptr(
+                        new inst::StaticListLiteral<platform::int_type>(
+                                util::mkptr(new inst::IntPrimitive)
+                              , int_list
+                              , std::vector<platform::int_type>({ 1, 2 }))))));
+    body0->addStmt(util::mkptr(new inst::Arithmetics(1, util::mkptr(
+                        new inst::StaticListLiteral<bool>(
+                                util::mkptr(new inst::BoolPrimitive)
+                              , bool_list
+                              , std::vector<bool>({ true }))))));
+    util::sptr<inst::Block> body1(new inst::Block);
+    body1->addStmt(util::mkptr(new inst::Arithmetics(1, util::mkptr(
+                        new inst::StaticListLiteral<platform::int_type>(
+                                util::mkptr(new inst::IntPrimitive)
+                              , int_list
+                              , std::vector<platform::int_type>({ 1, 2 }))))));
+
+    std::vector<util::sptr<inst::Function const>> funcs;
+    funcs.push_back(funcWithBody(std::move(body0)));
+    funcs.push_back(funcWithBody(std::move(body1)));
+    inst::writeStaticLists(funcs);
+
+    DataTree::expectOne()
+        (STATIC_LIST_BEGIN, int_list.str())
+        (STATIC_LIST_BEGIN, "int")
+            (INTEGER, "1")
+            (STATIC_LIST_MEMBER_END)
+            (INTEGER, "2")
+            (STATIC_LIST_MEMBER_END)
+        (STATIC_LIST_END, int_list.str())
+        (STATIC_LIST_END, "int", 2)
+
+        (STATIC_LIST_BEGIN, bool_list.str())
+        (STATIC_LIST_BEGIN, "bool")
+            (BOOLEAN, "true")
+            (STATIC_LIST_MEMBER_END)
+        (STATIC_LIST_END, bool_list.str())
+        (STATIC_LIST_END, "bool", 1)
     ;
 }
@@ -0,0 +1,99 @@
+#include <gtest/gtest.h>
+
+#include "test-common.h"
+#include "../last-read.h"
+#include "../function.h"
+#include "../stmt-nodes.h"
+#include "../expr-nodes.h"
+#include "../block.h"
+#include "../types.h"
+
+using namespace test;
+
+typedef InstanceTest LastReadTest;
+
+TEST_F(LastReadTest, MoveOnLastRead)
+{
+    util::serial_num call_sn(util::serial_num::next());
+    util::sptr<inst::Block> body(new inst::Block);
+
+    std::vector<util::sptr<inst::Expression const>> args;
+    args.push_back(listRef(1, 8));
+    body->addStmt(util::mkptr(new inst::Initialization(
+                        1
+                      , 0
+                      , util::mkptr(new inst::Call(call_sn, std::move(args)))
+                      , util::mkptr(new inst::ListType(util::mkptr(new inst::IntPrimitive))))));
+    body->addStmt(util::mkptr(new inst::Arithmetics(
+                        1, util::mkptr(new inst::ListAppend(listRef(1, 8), listRef(1, 8))))));
+    body->addStmt(util::mkptr(new inst::Arithmetics(1, listRef(1, 16))));
+
+    util::sptr<inst::Block> consequence(new inst::Block);
+    consequence->addStmt(util::mkptr(new inst::Return(1, listRef(1, 0))));
+    util::sptr<inst::Block> alternative(new inst::Block);
+    alternative->addStmt(util::mkptr(new inst::Arithmetics(1, listRef(1, 0))));
+    body->addStmt(util::mkptr(new inst::Branch(1
+                                             , util::mkptr(new inst::BoolLiteral(true))
+                                             , std::move(consequence)
+                                             , std::move(alternative))));
+    body->addStmt(util::mkptr(new inst::Return(1, listRef(1, 0))));
+
+    util::sptr<inst::Block> nested_body(new inst::Block);
+    nested_body->addStmt(util::mkptr(new inst::Return(2, listRef(1, 16))));
+
+    std::vector<util::sptr<inst::Function const>> funcs;
+    funcs.push_back(makeFunc(util::serial_num::next(), 1, std::move(body)));
+    funcs.push_back(makeFunc(util::serial_num::next(), 2, std::move(nested_body)));
+    inst::markLastReads(funcs);
+
+    funcs[0]->body->write();
+    funcs[1]->body->write();
+
+    DataTree::expectOne()
+        (BLOCK_BEGIN)
+            (INITIALIZE_THIS_LEVEL, "list [int]", 0)
+                (EXPRESSION_BEGIN)
+                (CALL_BEGIN)
+                (ARG_SEPARATOR)
+                    (REFERENCE, "list [int]", 1, 8)
+                (CALL_END)
+                (EXPRESSION_END)
+            (END_OF_STATEMENT)
+
+            (LIST_APPEND_BEGIN)
+                (REFERENCE, "list [int]", 1, 8)
+            (ARG_SEPARATOR)
+                (REFERENCE, "list [int]", 1, 8)
+            (LIST_APPEND_END)
+            (END_OF_STATEMENT)
+
+            (REFERENCE, "list [int]", 1, 16)
+            (END_OF_STATEMENT)
+
+            (BRANCH_IF)
+                (EXPRESSION_BEGIN)
+                (BOOLEAN, "true")
+                (EXPRESSION_END)
+                (BLOCK_BEGIN)
+                    (RETURN)
+                        (MOVE_REFERENCE, "list [int]", 1, 0)
+                    (END_OF_STATEMENT)
+                (BLOCK_END)
+            (BRANCH_ELSE)
+                (BLOCK_BEGIN)
+                    (REFERENCE, "list [int]", 1, 0)
+                    (END_OF_STATEMENT)
+                (BLOCK_END)
+
+            (RETURN)
+                (MOVE_REFERENCE, "list [int]", 1, 0)
+            (END_OF_STATEMENT)
+        (BLOCK_END)
+
+        (BLOCK_BEGIN)
+            (RETURN)
+                (REFERENCE, "list [int]", 1, 16)
+            (END_OF_STATEMENT)
+        (BLOCK_END)
+    ;
+}
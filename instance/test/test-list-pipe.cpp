@@ -0,0 +1,254 @@
+#include <gtest/gtest.h>
+
+#include <util/sn.h>
+
+#include "test-common.h"
+#include "../list-pipe.h"
+#include "../expr-nodes.h"
+
+using namespace test;
+
+typedef InstanceTest ListPipeTest;
+
+TEST_F(ListPipeTest, FusedPipeline)
+{
+    std::vector<util::sptr<inst::PipeBase const>> pipes;
+    pipes.push_back(util::mkptr(new inst::PipeMap(
+                            util::mkptr(new inst::BinaryOp(util::mkptr(new inst::ListElement)
+                                                         , "*"
+                                                         , util::mkptr(new inst::ListElement)))
+                          , false
+                          , util::mkptr(new inst::IntPrimitive)
+                          , util::mkptr(new inst::IntPrimitive))));
+    pipes.push_back(util::mkptr(new inst::PipeFilter(
+                            util::mkptr(new inst::BinaryOp(util::mkptr(new inst::ListIndex)
+                                                         , "<"
+                                                         , util::mkptr(new inst::IntLiteral(4))))
+                          , true
+                          , util::mkptr(new inst::IntPrimitive))));
+    pipes.push_back(util::mkptr(new inst::PipeMap(util::mkptr(new inst::ListIndex)
+                                                , true
+                                                , util::mkptr(new inst::IntPrimitive)
+                                                , util::mkptr(new inst::BoolPrimitive))));
+    inst::ListPipeline pipeline(util::mkptr(new inst::EmptyListLiteral), std::move(pipes), false);
+
+    pipeline.writePipeDef(1);
+    pipeline.write();
+
+    DataTree::expectOne()
+        (PIPELINE_BEGIN, "int")
+        (PIPELINE_BEGIN, "bool", 0)
+        (PIPE_FILTER_COUNTER)
+        (PIPELINE_LOOP_BEGIN, "int", 1)
+            (PIPE_MAP_BEGIN, "int")
+                (EXPRESSION_BEGIN)
+                    (PIPE_ELEMENT)
+                    (OPERATOR, "*")
+                    (PIPE_ELEMENT)
+                (EXPRESSION_END)
+            (PIPE_MAP_END, "int")
+            (PIPE_FILTER_BEGIN)
+                (EXPRESSION_BEGIN)
+                    (PIPE_INDEX)
+                    (OPERATOR, "<")
+                    (INTEGER, "4")
+                (EXPRESSION_END)
+            (PIPE_FILTER_END, 1)
+            (PIPE_MAP_BEGIN, "bool")
+                (PIPE_INDEX)
+            (PIPE_MAP_END, "bool")
+        (PIPELINE_LOOP_END)
+            (PIPE_STAGE_END)
+            (PIPE_STAGE_END)
+            (PIPE_STAGE_END)
+        (PIPELINE_END)
+
+        (PIPE_BEGIN, util::id(&pipeline).str())
+            (EMPTY_LIST)
+        (PIPE_END)
+    ;
+}
+
+TEST_F(ListPipeTest, IndexNotRead)
+{
+    std::vector<util::sptr<inst::PipeBase const>> pipes;
+    pipes.push_back(util::mkptr(new inst::PipeFilter(
+                            util::mkptr(new inst::BinaryOp(util::mkptr(new inst::ListIndex)
+                                                         , "<"
+                                                         , util::mkptr(new inst::IntLiteral(4))))
+                          , true
+                          , util::mkptr(new inst::IntPrimitive))));
+    pipes.push_back(util::mkptr(new inst::PipeFilter(
+                            util::mkptr(new inst::BinaryOp(util::mkptr(new inst::ListElement)
+                                                         , ">"
+                                                         , util::mkptr(new inst::IntLiteral(0))))
+                          , false
+                          , util::mkptr(new inst::IntPrimitive))));
+    inst::ListPipeline pipeline(util::mkptr(new inst::EmptyListLiteral), std::move(pipes), false);
+
+    pipeline.writePipeDef(1);
+
+    DataTree::expectOne()
+        (PIPELINE_BEGIN, "int")
+        (PIPELINE_BEGIN, "int", 0)
+        (PIPELINE_LOOP_BEGIN, "int", 1)
+            (PIPE_FILTER_BEGIN)
+                (EXPRESSION_BEGIN)
+                    (PIPE_INDEX)
+                    (OPERATOR, "<")
+                    (INTEGER, "4")
+                (EXPRESSION_END)
+            (PIPE_FILTER_END, 0)
+            (PIPE_FILTER_BEGIN)
+                (EXPRESSION_BEGIN)
+                    (PIPE_ELEMENT)
+                    (OPERATOR, ">")
+                    (INTEGER, "0")
+                (EXPRESSION_END)
+            (PIPE_FILTER_END, 0)
+        (PIPELINE_LOOP_END)
+            (PIPE_STAGE_END)
+            (PIPE_STAGE_END)
+        (PIPELINE_END)
+    ;
+}
+
+TEST_F(ListPipeTest, WritingStageEndsRun)
+{
+    std::vector<util::sptr<inst::PipeBase const>> pipes;
+    pipes.push_back(util::mkptr(new inst::PipeMap(util::mkptr(new inst::ListElement)
+                                                , false
+                                                , util::mkptr(new inst::IntPrimitive)
+                                                , util::mkptr(new inst::IntPrimitive))));
+    pipes.push_back(util::mkptr(new inst::PipeMap(util::mkptr(new inst::ListIndex)
+                                                , true
+                                                , util::mkptr(new inst::IntPrimitive)
+                                                , util::mkptr(new inst::FloatPrimitive))));
+    pipes[0]->may_write = true;
+    util::id const second_run(pipes[1].id());
+    inst::ListPipeline pipeline(util::mkptr(new inst::EmptyListLiteral), std::move(pipes), false);
+
+    pipeline.writePipeDef(1);
+    pipeline.write();
+
+    DataTree::expectOne()
+        (PIPELINE_BEGIN, "int")
+        (PIPELINE_BEGIN, "int", 0)
+        (PIPELINE_LOOP_BEGIN, "int", 0)
+            (PIPE_MAP_BEGIN, "int")
+                (PIPE_ELEMENT)
+            (PIPE_MAP_END, "int")
+        (PIPELINE_LOOP_END)
+            (PIPE_STAGE_END)
+        (PIPELINE_END)
+
+        (PIPELINE_BEGIN, "int")
+        (PIPELINE_BEGIN, "float", 0)
+        (PIPELINE_LOOP_BEGIN, "int", 1)
+            (PIPE_MAP_BEGIN, "float")
+                (PIPE_INDEX)
+            (PIPE_MAP_END, "float")
+        (PIPELINE_LOOP_END)
+            (PIPE_STAGE_END)
+        (PIPELINE_END)
+
+        (PIPE_BEGIN, second_run.str())
+        (PIPE_BEGIN, util::id(&pipeline).str())
+            (EMPTY_LIST)
+        (PIPE_END)
+        (PIPE_END)
+    ;
+}
+
+TEST_F(ListPipeTest, Slice)
+{
+    std::vector<util::sptr<inst::SliceBound const>> bounds;
+    bounds.push_back(util::mkptr(new inst::SliceBound(">=", util::mkptr(new inst::IntLiteral(1)))));
+    bounds.push_back(util::mkptr(new inst::SliceBound("<", util::mkptr(new inst::IntLiteral(5)))));
+    inst::ListSlice slice(util::mkptr(new inst::EmptyListLiteral), std::move(bounds));
+    slice.write();
+
+    DataTree::expectOne()
+        (LIST_SLICE_BEGIN)
+            (EMPTY_LIST)
+        (LIST_SLICE_BOUND, ">=")
+            (INTEGER, "1")
+        (LIST_SLICE_BOUND, "<")
+            (INTEGER, "5")
+        (LIST_SLICE_END)
+    ;
+}
+
+TEST_F(ListPipeTest, Kernel)
+{
+    std::vector<util::sptr<inst::Expression const>> invariants;
+    invariants.push_back(util::mkptr(new inst::IntLiteral(3)));
+    std::vector<util::sptr<inst::Expression const>> maps;
+    maps.push_back(util::mkptr(new inst::BinaryOp(util::mkptr(new inst::ListElement)
+                                                , "*"
+                                                , util::mkptr(new inst::KernelInvariant(0)))));
+    maps.push_back(util::mkptr(new inst::BinaryOp(util::mkptr(new inst::ListElement)
+                                                , "+"
+                                                , util::mkptr(new inst::ListIndex))));
+    inst::PipeKernel kernel(util::mkptr(new inst::EmptyListLiteral)
+                          , util::mkptr(new inst::IntPrimitive)
+                          , std::move(invariants)
+                          , std::move(maps)
+                          , true
+                          , true);
+
+    kernel.writePipeDef(2);
+    kernel.write();
+
+    DataTree::expectOne()
+        (PIPE_KERNEL_BEGIN, "int", 1)
+        (PIPE_KERNEL_INVARIANT_BEGIN, "int", 0)
+            (INTEGER, "3")
+        (PIPE_KERNEL_INVARIANT_END, "int", 0)
+        (PIPE_KERNEL_VECTOR_LOOP_BEGIN, "int", 1)
+            (PIPE_KERNEL_VECTOR_INVARIANT, "int", 0)
+            (PIPE_MAP_BEGIN, "simd [int]")
+                (EXPRESSION_BEGIN)
+                    (PIPE_ELEMENT)
+                    (OPERATOR, "*")
+                    (PIPE_KERNEL_INVARIANT, 0)
+                (EXPRESSION_END)
+            (PIPE_MAP_END, "simd [int]")
+            (PIPE_MAP_BEGIN, "simd [int]")
+                (EXPRESSION_BEGIN)
+                    (PIPE_ELEMENT)
+                    (OPERATOR, "+")
+                    (PIPE_INDEX)
+                (EXPRESSION_END)
+            (PIPE_MAP_END, "simd [int]")
+        (PIPE_KERNEL_VECTOR_LOOP_END, "int")
+            (PIPE_STAGE_END)
+            (PIPE_STAGE_END)
+        (PIPE_KERNEL_LOOP_CLOSE)
+        (PIPE_KERNEL_SCALAR_LOOP_BEGIN, "int", 1)
+            (PIPE_KERNEL_SCALAR_INVARIANT, "int", 0)
+            (PIPE_MAP_BEGIN, "int")
+                (EXPRESSION_BEGIN)
+                    (PIPE_ELEMENT)
+                    (OPERATOR, "*")
+                    (PIPE_KERNEL_INVARIANT, 0)
+                (EXPRESSION_END)
+            (PIPE_MAP_END, "int")
+            (PIPE_MAP_BEGIN, "int")
+                (EXPRESSION_BEGIN)
+                    (PIPE_ELEMENT)
+                    (OPERATOR, "+")
+                    (PIPE_INDEX)
+                (EXPRESSION_END)
+            (PIPE_MAP_END, "int")
+        (PIPE_KERNEL_SCALAR_LOOP_END)
+            (PIPE_STAGE_END)
+            (PIPE_STAGE_END)
+        (PIPE_KERNEL_LOOP_CLOSE)
+        (PIPE_KERNEL_END)
+
+        (PIPE_BEGIN, util::id(&kernel).str())
+            (EMPTY_LIST)
+        (PIPE_END)
+    ;
+}
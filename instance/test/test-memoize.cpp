@@ -0,0 +1,166 @@
+#include <gtest/gtest.h>
+
+#include <misc/options.h>
+
+#include "test-common.h"
+#include "../memoize.h"
+#include "../function.h"
+#include "../stmt-nodes.h"
+#include "../expr-nodes.h"
+#include "../built-in.h"
+#include "../block.h"
+#include "../list-pipe.h"
+#include "../types.h"
+
+using namespace test;
+
+typedef InstanceTest MemoizeTest;
+
+TEST_F(MemoizeTest, PureFuncs)
+{
+    util::serial_num pure_sn(util::serial_num::next());
+    util::serial_num nested_sn(util::serial_num::next());
+    util::serial_num writer_sn(util::serial_num::next());
+    util::serial_num caller_sn(util::serial_num::next());
+
+    util::sptr<inst::Block> pure_body(new inst::Block);
+    pure_body->addStmt(util::mkptr(new inst::Arithmetics(1, call(pure_sn, intRef(1, 0)))));
+    pure_body->addStmt(util::mkptr(new inst::Return(1, call(nested_sn, intRef(1, 0)))));
+
+    util::sptr<inst::Block> nested_body(new inst::Block);
+    nested_body->addStmt(util::mkptr(new inst::Return(2, intRef(1, 0))));
+
+    util::sptr<inst::Block> writer_body(new inst::Block);
+    writer_body->addStmt(util::mkptr(new inst::Arithmetics(
+                    1, util::mkptr(new inst::WriterExpr(intRef(1, 0))))));
+    writer_body->addStmt(util::mkptr(new inst::Return(1, intRef(1, 0))));
+
+    util::sptr<inst::Block> caller_body(new inst::Block);
+    caller_body->addStmt(util::mkptr(new inst::Return(1, call(writer_sn, intRef(1, 0)))));
+
+    std::vector<util::sptr<inst::Function const>> funcs;
+    funcs.push_back(makeFunc(pure_sn, 1, std::move(pure_body)));
+    funcs.push_back(makeFunc(nested_sn, 2, std::move(nested_body)));
+    funcs.push_back(makeFunc(writer_sn, 1, std::move(writer_body)));
+    funcs.push_back(makeFunc(caller_sn, 1, std::move(caller_body)));
+    misc::options::get().memoize = true;
+    inst::markMemoizedFuncs(funcs);
+    misc::options::get().memoize = false;
+
+    std::for_each(funcs.begin()
+                , funcs.end()
+                , [&](util::sptr<inst::Function const> const& func)
+                  {
+                      func->writeDecl();
+                      func->body->write();
+                  });
+
+    DataTree::expectOne()
+        (FUNC_DECL_BEGIN, "int", 1, 8)
+            (FUNC_RES_ENTRY, 0)
+            (PARAMETER, "int", 1, 0)
+        (FUNC_DECL_END)
+        (MEMO_TABLE, "int", 1)
+        (BLOCK_BEGIN)
+            (MEMO_CALL_BEGIN)
+            (ARG_SEPARATOR)
+                (REFERENCE, "int", 1, 0)
+            (MEMO_CALL_END)
+            (END_OF_STATEMENT)
+            (RETURN)
+                (CALL_BEGIN)
+                (ARG_SEPARATOR)
+                    (REFERENCE, "int", 1, 0)
+                (CALL_END)
+            (END_OF_STATEMENT)
+        (BLOCK_END)
+
+        (FUNC_DECL_BEGIN, "int", 2, 8)
+            (FUNC_RES_ENTRY, 0)
+            (PARAMETER, "int", 2, 0)
+        (FUNC_DECL_END)
+        (BLOCK_BEGIN)
+            (RETURN)
+                (REFERENCE, "int", 1, 0)
+            (END_OF_STATEMENT)
+        (BLOCK_END)
+
+        (FUNC_DECL_BEGIN, "int", 1, 8)
+            (FUNC_RES_ENTRY, 0)
+            (PARAMETER, "int", 1, 0)
+        (FUNC_DECL_END)
+        (BLOCK_BEGIN)
+            (WRITER_BEGIN)
+                (REFERENCE, "int", 1, 0)
+            (WRITER_END)
+            (END_OF_STATEMENT)
+            (RETURN)
+                (REFERENCE, "int", 1, 0)
+            (END_OF_STATEMENT)
+        (BLOCK_END)
+
+        (FUNC_DECL_BEGIN, "int", 1, 8)
+            (FUNC_RES_ENTRY, 0)
+            (PARAMETER, "int", 1, 0)
+        (FUNC_DECL_END)
+        (BLOCK_BEGIN)
+            (RETURN)
+                (CALL_BEGIN)
+                (ARG_SEPARATOR)
+                    (REFERENCE, "int", 1, 0)
+                (CALL_END)
+            (END_OF_STATEMENT)
+        (BLOCK_END)
+    ;
+}
+
+TEST_F(MemoizeTest, WritingStages)
+{
+    util::serial_num writer_sn(util::serial_num::next());
+    util::serial_num caller_sn(util::serial_num::next());
+    util::serial_num pure_sn(util::serial_num::next());
+    util::serial_num pipe_sn(util::serial_num::next());
+
+    util::sptr<inst::Block> writer_body(new inst::Block);
+    writer_body->addStmt(util::mkptr(new inst::Arithmetics(
+                    1, util::mkptr(new inst::WriterExpr(intRef(1, 0))))));
+    writer_body->addStmt(util::mkptr(new inst::Return(1, intRef(1, 0))));
+
+    util::sptr<inst::Block> caller_body(new inst::Block);
+    caller_body->addStmt(util::mkptr(new inst::Return(1, call(writer_sn, intRef(1, 0)))));
+
+    util::sptr<inst::Block> pure_body(new inst::Block);
+    pure_body->addStmt(util::mkptr(new inst::Return(1, intRef(1, 0))));
+
+    std::vector<util::sptr<inst::PipeBase const>> pipes;
+    pipes.push_back(util::mkptr(new inst::PipeMap(call(pure_sn, util::mkptr(new inst::ListElement))
+                                                , false
+                                                , util::mkptr(new inst::IntPrimitive)
+                                                , util::mkptr(new inst::IntPrimitive))));
+    pipes.push_back(util::mkptr(new inst::PipeMap(call(caller_sn
+                                                     , util::mkptr(new inst::ListElement))
+                                                , false
+                                                , util::mkptr(new inst::IntPrimitive)
+                                                , util::mkptr(new inst::IntPrimitive))));
+    pipes.push_back(util::mkptr(new inst::PipeFilter(
+                            util::mkptr(new inst::WriterExpr(util::mkptr(new inst::ListElement)))
+                          , false
+                          , util::mkptr(new inst::IntPrimitive))));
+    util::sref<inst::PipeBase const> pure_stage(*pipes[0]);
+    util::sref<inst::PipeBase const> caller_stage(*pipes[1]);
+    util::sref<inst::PipeBase const> writer_stage(*pipes[2]);
+    util::sptr<inst::Block> pipe_body(new inst::Block);
+    pipe_body->addStmt(util::mkptr(new inst::Return(1, util::mkptr(
+                    new inst::ListPipeline(listRef(1, 0), std::move(pipes), false)))));
+
+    std::vector<util::sptr<inst::Function const>> funcs;
+    funcs.push_back(makeFunc(writer_sn, 1, std::move(writer_body)));
+    funcs.push_back(makeFunc(caller_sn, 1, std::move(caller_body)));
+    funcs.push_back(makeFunc(pure_sn, 1, std::move(pure_body)));
+    funcs.push_back(makeFunc(pipe_sn, 1, std::move(pipe_body)));
+    inst::markWritingStages(funcs);
+
+    ASSERT_FALSE(pure_stage->may_write);
+    ASSERT_TRUE(caller_stage->may_write);
+    ASSERT_TRUE(writer_stage->may_write);
+}
@@ -0,0 +1,47 @@
+#include <gtest/gtest.h>
+
+#include "test-common.h"
+#include "../outer-levels.h"
+#include "../function.h"
+#include "../stmt-nodes.h"
+#include "../expr-nodes.h"
+#include "../block.h"
+#include "../types.h"
+
+using namespace test;
+
+typedef InstanceTest OuterLevelsTest;
+
+TEST_F(OuterLevelsTest, MarkOuterLevels)
+{
+    util::serial_num own_sn(util::serial_num::next());
+    util::serial_num reader_sn(util::serial_num::next());
+    util::serial_num caller_sn(util::serial_num::next());
+    util::serial_num outer_caller_sn(util::serial_num::next());
+
+    util::sptr<inst::Block> own_body(new inst::Block);
+    own_body->addStmt(util::mkptr(new inst::Return(4, intRef(4, 0))));
+
+    util::sptr<inst::Block> reader_body(new inst::Block);
+    reader_body->addStmt(util::mkptr(new inst::Arithmetics(3, intRef(1, 0))));
+    reader_body->addStmt(util::mkptr(new inst::Return(3, intRef(2, 8))));
+
+    util::sptr<inst::Block> caller_body(new inst::Block);
+    caller_body->addStmt(util::mkptr(new inst::Return(4, call(reader_sn, intRef(0, 0)))));
+
+    util::sptr<inst::Block> outer_caller_body(new inst::Block);
+    outer_caller_body->addStmt(util::mkptr(new inst::Return(2, call(reader_sn, intRef(2, 0)))));
+
+    std::vector<util::sptr<inst::Function const>> funcs;
+    funcs.push_back(makeFunc(own_sn, 4, std::move(own_body)));
+    funcs.push_back(makeFunc(reader_sn, 3, std::move(reader_body)));
+    funcs.push_back(makeFunc(caller_sn, 4, std::move(caller_body)));
+    funcs.push_back(makeFunc(outer_caller_sn, 2, std::move(outer_caller_body)));
+    ASSERT_EQ(std::vector<int>({ 0, 1, 2, 3 }), funcs[0]->outer_levels);
+
+    inst::markOuterLevels(funcs);
+    ASSERT_EQ(std::vector<int>(), funcs[0]->outer_levels);
+    ASSERT_EQ(std::vector<int>({ 1, 2 }), funcs[1]->outer_levels);
+    ASSERT_EQ(std::vector<int>({ 0, 1, 2 }), funcs[2]->outer_levels);
+    ASSERT_EQ(std::vector<int>({ 1 }), funcs[3]->outer_levels);
+}
@@ -0,0 +1,120 @@
+#include <gtest/gtest.h>
+
+#include "test-common.h"
+#include "../plain-func.h"
+#include "../function.h"
+#include "../stmt-nodes.h"
+#include "../expr-nodes.h"
+#include "../block.h"
+#include "../types.h"
+
+using namespace test;
+
+typedef InstanceTest PlainFuncTest;
+
+TEST_F(PlainFuncTest, MarkPlainFuncs)
+{
+    util::serial_num leaf_sn(util::serial_num::next());
+    util::serial_num caller_sn(util::serial_num::next());
+    util::serial_num nested_sn(util::serial_num::next());
+    util::serial_num nested_caller_sn(util::serial_num::next());
+    util::serial_num lister_sn(util::serial_num::next());
+
+    util::sptr<inst::Block> leaf_body(new inst::Block);
+    leaf_body->addStmt(util::mkptr(new inst::Return(1, intRef(1, 0))));
+
+    util::sptr<inst::Block> caller_body(new inst::Block);
+    caller_body->addStmt(util::mkptr(new inst::Return(1, call(leaf_sn, intRef(1, 0)))));
+
+    util::sptr<inst::Block> nested_body(new inst::Block);
+    nested_body->addStmt(util::mkptr(new inst::Return(2, intRef(1, 0))));
+
+    util::sptr<inst::Block> nested_caller_body(new inst::Block);
+    nested_caller_body->addStmt(util::mkptr(new inst::Return(1, call(nested_sn, intRef(1, 0)))));
+
+    std::vector<util::sptr<inst::Expression const>> members;
+    members.push_back(intRef(1, 0));
+    util::sptr<inst::Block> lister_body(new inst::Block);
+    lister_body->addStmt(util::mkptr(new inst::Arithmetics(1, util::mkptr(
+                        new inst::ListLiteral(util::mkptr(new inst::IntPrimitive)
+                                            , std::move(members))))));
+    lister_body->addStmt(util::mkptr(new inst::Return(1, call(leaf_sn, intRef(1, 0)))));
+
+    std::vector<util::sptr<inst::Function const>> funcs;
+    funcs.push_back(makeFunc(leaf_sn, 1, std::move(leaf_body)));
+    funcs.push_back(makeFunc(caller_sn, 1, std::move(caller_body)));
+    funcs.push_back(makeFunc(nested_sn, 2, std::move(nested_body)));
+    funcs.push_back(makeFunc(nested_caller_sn, 1, std::move(nested_caller_body)));
+    funcs.push_back(makeFunc(lister_sn, 1, std::move(lister_body)));
+    inst::markPlainFuncs(funcs);
+
+    std::for_each(funcs.begin()
+                , funcs.end()
+                , [&](util::sptr<inst::Function const> const& func)
+                  {
+                      func->writeDecl();
+                      func->body->write();
+                  });
+
+    DataTree::expectOne()
+        (PLAIN_FUNC_DECL, "int", 0, 8)
+            (PARAMETER, "int", 1, 0)
+        (BLOCK_BEGIN)
+            (RETURN)
+                (REFERENCE, "int", 1, 0)
+            (END_OF_STATEMENT)
+        (BLOCK_END)
+
+        (PLAIN_FUNC_DECL, "int", 0, 8)
+            (PARAMETER, "int", 1, 0)
+        (BLOCK_BEGIN)
+            (RETURN)
+                (PLAIN_CALL_BEGIN)
+                (ARG_SEPARATOR)
+                    (REFERENCE, "int", 1, 0)
+                (PLAIN_CALL_END)
+            (END_OF_STATEMENT)
+        (BLOCK_END)
+
+        (FUNC_DECL_BEGIN, "int", 2, 8)
+            (FUNC_RES_ENTRY, 0)
+            (PARAMETER, "int", 2, 0)
+        (FUNC_DECL_END)
+        (BLOCK_BEGIN)
+            (RETURN)
+                (REFERENCE, "int", 1, 0)
+            (END_OF_STATEMENT)
+        (BLOCK_END)
+
+        (FUNC_DECL_BEGIN, "int", 1, 8)
+            (FUNC_RES_ENTRY, 0)
+            (PARAMETER, "int", 1, 0)
+        (FUNC_DECL_END)
+        (BLOCK_BEGIN)
+            (RETURN)
+                (CALL_BEGIN)
+                (ARG_SEPARATOR)
+                    (REFERENCE, "int", 1, 0)
+                (CALL_END)
+            (END_OF_STATEMENT)
+        (BLOCK_END)
+
+        (FUNC_DECL_BEGIN, "int", 1, 8)
+            (FUNC_RES_ENTRY, 0)
+            (PARAMETER, "int", 1, 0)
+        (FUNC_DECL_END)
+        (BLOCK_BEGIN)
+            (LIST_BEGIN, "int", 1)
+            (LIST_NEXT_MEMBER)
+                (REFERENCE, "int", 1, 0)
+            (LIST_END)
+            (END_OF_STATEMENT)
+            (RETURN)
+                (PLAIN_CALL_BEGIN)
+                (ARG_SEPARATOR)
+                    (REFERENCE, "int", 1, 0)
+                (PLAIN_CALL_END)
+            (END_OF_STATEMENT)
+        (BLOCK_END)
+    ;
+}
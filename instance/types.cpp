@@ -1,17 +1,24 @@
 #include <output/name-mangler.h>
-#include <output/stmt-writer.h>
 
 #include "types.h"
 
 using namespace inst;
 
-void Type::writeResEntry(int) const {}
-
 util::sptr<output::StackVarRec const> Type::makeParameter(Address const& addr) const
 {
     return util::mkptr(new output::Parameter(exportedName(), addr.offset, addr.level));
 }
 
+bool Type::isResource() const
+{
+    return false;
+}
+
+bool Type::isScalar() const
+{
+    return false;
+}
+
 std::string VoidPrimitive::exportedName() const
 {
     return output::formType("void");
@@ -22,16 +29,31 @@ std::string IntPrimitive::exportedName() const
     return output::formType("int");
 }
 
+bool IntPrimitive::isScalar() const
+{
+    return true;
+}
+
 std::string FloatPrimitive::exportedName() const
 {
     return output::formType("float");
 }
 
+bool FloatPrimitive::isScalar() const
+{
+    return true;
+}
+
 std::string BoolPrimitive::exportedName() const
 {
     return output::formType("bool");
 }
 
+bool BoolPrimitive::isScalar() const
+{
+    return true;
+}
+
 std::string EmptyListType::exportedName() const
 {
     return output::emptyListType();
@@ -42,17 +64,12 @@ std::string ListType::exportedName() const
     return output::formListType(member_type->exportedName());
 }
 
-util::sptr<output::StackVarRec const> ListType::makeParameter(Address const& addr) const
+bool ListType::isResource() const
 {
-    return util::mkptr(new output::ResourceParam(exportedName(), addr.offset, addr.level));
+    return true;
 }
 
 std::string ClosureType::exportedName() const
 {
     return output::formFuncReferenceType(size);
 }
-
-void ListType::writeResEntry(int offset) const
-{
-    output::addResEntry(offset);
-}
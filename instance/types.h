@@ -15,8 +15,9 @@ namespace inst {
         virtual ~Type() {}
     public:
         virtual std::string exportedName() const = 0;
-        virtual void writeResEntry(int offset) const;
         virtual util::sptr<output::StackVarRec const> makeParameter(Address const& addr) const;
+        virtual bool isResource() const;
+        virtual bool isScalar() const;
     };
 
     struct VoidPrimitive
@@ -29,18 +30,21 @@ namespace inst {
         : public Type
     {
         std::string exportedName() const;
+        bool isScalar() const;
     };
 
     struct FloatPrimitive
         : public Type
     {
         std::string exportedName() const;
+        bool isScalar() const;
     };
 
     struct BoolPrimitive
         : public Type
     {
         std::string exportedName() const;
+        bool isScalar() const;
     };
 
     struct EmptyListType
@@ -57,8 +61,7 @@ namespace inst {
         {}
 
         std::string exportedName() const;
-        void writeResEntry(int offset) const;
-        util::sptr<output::StackVarRec const> makeParameter(Address const& addr) const;
+        bool isResource() const;
 
         util::sptr<Type const> const member_type;
     };
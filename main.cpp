@@ -5,6 +5,7 @@
 
 #include <parser/yy-misc.h>
 #include <grammar/clause-builder.h>
+#include <grammar/node-base.h>
 #include <flowcheck/filter.h>
 #include <flowcheck/node-base.h>
 #include <flowcheck/function.h>
@@ -16,10 +17,18 @@
 #include <proto/type.h>
 #include <proto/func-reference-type.h>
 #include <instance/node-base.h>
+#include <instance/last-read.h>
+#include <instance/memoize.h>
+#include <instance/plain-func.h>
+#include <instance/outer-levels.h>
+#include <instance/function.h>
 #include <output/func-writer.h>
+#include <output/emitter.h>
+#include <util/arena.h>
 #include <util/pointer.h>
 #include <report/errors.h>
 #include <inspect/trace.h>
+#include <misc/options.h>
 
 namespace {
 
@@ -40,6 +49,25 @@ namespace {
         {}
     };
 
+    /*
+     * Nodes a phase allocates after the mark are dropped together once the
+     * tree they form has been destroyed.
+     */
+    struct PhaseNodes {
+        explicit PhaseNodes(util::arena& a)
+            : nodes(a)
+            , mark(a.mark())
+        {}
+
+        void release()
+        {
+            nodes.release(mark);
+        }
+
+        util::arena& nodes;
+        std::size_t const mark;
+    };
+
 }
 
 static util::sptr<flchk::Filter> frontEnd()
@@ -78,6 +106,14 @@ static Functions semantic(util::sptr<flchk::Filter> global_flow)
 
 static void outputAll(Functions funcs)
 {
+    inst::markLastReads(funcs.funcs);
+    inst::markMemoizedFuncs(funcs.funcs);
+    inst::markWritingStages(funcs.funcs);
+    inst::markTailCalls(funcs.funcs);
+    inst::markFrameSlots(funcs.funcs);
+    inst::markPlainFuncs(funcs.funcs);
+    inst::markOuterLevels(funcs.funcs);
+    inst::writeStaticLists(funcs.funcs);
     std::for_each(funcs.funcs.begin()
                 , funcs.funcs.end()
                 , [&](util::sptr<inst::Function const> const& func)
@@ -93,13 +129,31 @@ static void outputAll(Functions funcs)
                   {
                       func->writeImpl();
                   });
+    output::emitter().flush();
+    if (error::hasError()) {
+        throw CompileFailure();
+    }
 }
 
-int main()
+int main(int argc, char* argv[])
 {
+    if (!misc::options::parse(argc, argv)) {
+        return 1;
+    }
     inspect::prepare_for_trace();
     try {
-        outputAll(semantic(frontEnd()));
+        PhaseNodes grammar_nodes(grammar::ArenaNode::nodes_arena());
+        PhaseNodes flchk_nodes(flchk::ArenaNode::nodes_arena());
+        PhaseNodes proto_nodes(proto::ArenaNode::nodes_arena());
+        PhaseNodes inst_nodes(inst::ArenaNode::nodes_arena());
+
+        util::sptr<flchk::Filter> global_flow(frontEnd());
+        grammar_nodes.release();
+        Functions funcs(semantic(std::move(global_flow)));
+        flchk_nodes.release();
+        proto_nodes.release();
+        outputAll(std::move(funcs));
+        inst_nodes.release();
         return 0;
     } catch (CompileFailure) {
         return 1;
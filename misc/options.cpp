@@ -0,0 +1,42 @@
+#include <iostream>
+#include <string>
+
+#include "options.h"
+
+using namespace misc;
+
+options& options::get()
+{
+    static options o;
+    return o;
+}
+
+bool options::parse(int argc, char* argv[])
+{
+    for (int i = 1; i < argc; ++i) {
+        std::string const arg(argv[i]);
+        if ("--no-simd-kernel" == arg) {
+            get().simd_kernel = false;
+        } else if ("--no-parallel-pipe" == arg) {
+            get().parallel_pipe = false;
+        } else if ("--no-frame-arena" == arg) {
+            get().frame_arena = false;
+        } else if ("--no-move-last-read" == arg) {
+            get().move_last_read = false;
+        } else if ("--memoize" == arg) {
+            get().memoize = true;
+        } else if ("--no-tail-call" == arg) {
+            get().tail_call = false;
+        } else if ("--no-typed-frame" == arg) {
+            get().typed_frame = false;
+        } else if ("--no-plain-func" == arg) {
+            get().plain_func = false;
+        } else if ("--no-compact-bases" == arg) {
+            get().compact_bases = false;
+        } else {
+            std::cerr << "Unknown option: " << arg << std::endl;
+            return false;
+        }
+    }
+    return true;
+}
@@ -0,0 +1,35 @@
+#ifndef __STEKIN_MISCELLANY_OPTIONS_H__
+#define __STEKIN_MISCELLANY_OPTIONS_H__
+
+namespace misc {
+
+    struct options {
+        bool simd_kernel;
+        bool parallel_pipe;
+        bool frame_arena;
+        bool move_last_read;
+        bool memoize;
+        bool tail_call;
+        bool typed_frame;
+        bool plain_func;
+        bool compact_bases;
+
+        options()
+            : simd_kernel(true)
+            , parallel_pipe(true)
+            , frame_arena(true)
+            , move_last_read(true)
+            , memoize(false)
+            , tail_call(true)
+            , typed_frame(true)
+            , plain_func(true)
+            , compact_bases(true)
+        {}
+
+        static options& get();
+        static bool parse(int argc, char* argv[]);
+    };
+
+}
+
+#endif /* __STEKIN_MISCELLANY_OPTIONS_H__ */
@@ -1,13 +1,12 @@
-#include <iostream>
-
 #include "built-in-writer.h"
+#include "emitter.h"
 
 void output::beginWriterStmt()
 {
-    std::cout << "std::cout << ";
+    emitter() << "_stk_write(";
 }
 
 void output::endWriterStmt()
 {
-    std::cout << " << std::endl";
+    emitter() << ")";
 }
@@ -0,0 +1,117 @@
+#include <cstdio>
+#include <cstring>
+#include <cerrno>
+#include <unistd.h>
+
+#include <report/errors.h>
+
+#include "emitter.h"
+
+using namespace output;
+
+static std::size_t const FLUSH_THRESHOLD = 64 * 1024;
+
+void FdSink::write(char const* data, std::size_t size)
+{
+    while (!failed && 0 < size) {
+        ssize_t written = ::write(fd, data, size);
+        if (written < 0) {
+            if (EINTR == errno) {
+                continue;
+            }
+            failed = true;
+            error::outputFailed(std::strerror(errno));
+            return;
+        }
+        data += written;
+        size -= written;
+    }
+}
+
+void MemorySink::write(char const* data, std::size_t size)
+{
+    content.append(data, size);
+}
+
+Emitter::~Emitter()
+{
+    flush();
+}
+
+void Emitter::_append(char const* data, std::size_t size)
+{
+    _buffer.insert(_buffer.end(), data, data + size);
+    if (FLUSH_THRESHOLD <= _buffer.size()) {
+        flush();
+    }
+}
+
+Emitter& Emitter::operator<<(std::string const& s)
+{
+    _append(s.data(), s.size());
+    return *this;
+}
+
+Emitter& Emitter::operator<<(char const* s)
+{
+    _append(s, std::strlen(s));
+    return *this;
+}
+
+Emitter& Emitter::operator<<(char c)
+{
+    _append(&c, 1);
+    return *this;
+}
+
+Emitter& Emitter::operator<<(bool b)
+{
+    return *this << (b ? '1' : '0');
+}
+
+Emitter& Emitter::operator<<(int i)
+{
+    return *this << static_cast<long long>(i);
+}
+
+Emitter& Emitter::operator<<(long i)
+{
+    return *this << static_cast<long long>(i);
+}
+
+Emitter& Emitter::operator<<(long long i)
+{
+    char image[32];
+    _append(image, std::snprintf(image, sizeof image, "%lld", i));
+    return *this;
+}
+
+Emitter& Emitter::operator<<(double d)
+{
+    char image[32];
+    _append(image, std::snprintf(image, sizeof image, "%g", d));
+    return *this;
+}
+
+void Emitter::flush()
+{
+    if (!_buffer.empty()) {
+        _sink->write(_buffer.data(), _buffer.size());
+        _buffer.clear();
+    }
+}
+
+util::sref<Sink> Emitter::redirect(util::sref<Sink> sink)
+{
+    flush();
+    util::sref<Sink> previous = _sink;
+    _sink = sink;
+    return previous;
+}
+
+Emitter& output::emitter()
+{
+    static FdSink stdout_sink(STDOUT_FILENO);
+    static Emitter emitter(util::mkref<Sink>(stdout_sink));
+    return emitter;
+}
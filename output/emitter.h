@@ -0,0 +1,80 @@
+#ifndef __STEKIN_OUTPUT_EMITTER_H__
+#define __STEKIN_OUTPUT_EMITTER_H__
+
+#include <string>
+#include <vector>
+
+#include <util/pointer.h>
+
+namespace output {
+
+    struct Sink {
+        virtual ~Sink() {}
+
+        virtual void write(char const* data, std::size_t size) = 0;
+    };
+
+    struct FdSink
+        : public Sink
+    {
+        explicit FdSink(int f)
+            : fd(f)
+            , failed(false)
+        {}
+
+        /* reports the first failing write; nothing is written after it */
+        void write(char const* data, std::size_t size);
+
+        int const fd;
+        bool failed;
+    };
+
+    struct MemorySink
+        : public Sink
+    {
+        void write(char const* data, std::size_t size);
+
+        std::string content;
+    };
+
+    /*
+     * Collects the generated code in a growable buffer and hands it to the
+     * sink in large writes.  Values are formatted as std::ostream does by
+     * default, so the output is the same as streaming them to std::cout.
+     */
+    struct Emitter {
+        explicit Emitter(util::sref<Sink> sink)
+            : _sink(sink)
+        {}
+
+        ~Emitter();
+
+        Emitter& operator<<(std::string const& s);
+        Emitter& operator<<(char const* s);
+        Emitter& operator<<(char c);
+        Emitter& operator<<(bool b);
+        Emitter& operator<<(int i);
+        Emitter& operator<<(long i);
+        Emitter& operator<<(long long i);
+        Emitter& operator<<(double d);
+
+        void flush();
+        util::sref<Sink> redirect(util::sref<Sink> sink);
+    private:
+        void _append(char const* data, std::size_t size);
+    private:
+        util::sref<Sink> _sink;
+        std::vector<char> _buffer;
+
+        Emitter(Emitter const&) = delete;
+    };
+
+    /*
+     * The emitter every writer goes through; it goes to stdout unless
+     * redirected.  Output is complete only after flush().
+     */
+    Emitter& emitter();
+
+}
+
+#endif /* __STEKIN_OUTPUT_EMITTER_H__ */
@@ -1,80 +1,154 @@
-#include <iostream>
-
 #include "expr-writer.h"
+#include "emitter.h"
 #include "name-mangler.h"
 
 void output::writeInt(platform::int_type i)
 {
-    std::cout << "_stk_type_int(" << i << ")";
+    emitter() << "_stk_type_int(" << i << ")";
 }
 
 void output::writeFloat(platform::float_type d)
 {
-    std::cout << "_stk_type_float(" << d << ")";
+    emitter() << "_stk_type_float(" << d << ")";
 }
 
 void output::writeBool(bool b)
 {
-    std::cout << "_stk_type_bool(" << b << ")";
+    emitter() << "_stk_type_bool(" << b << ")";
 }
 
 void output::refLevel(int offset, int level, std::string const& type_exported_name)
 {
-    std::cout << "(*(" << type_exported_name << "*)"
-                 "(" << offset << " + (char*)(_stk_bases._stk_ext_bases[" << level << "])))";
+    emitter() << "(*(" << type_exported_name << "*)"
+                 "(" << offset << " + (char*)(_stk_bases.template base<" << level << ">())))";
+}
+
+void output::moveRefLevel(int offset, int level, std::string const& type_exported_name)
+{
+    emitter() << "std::move(";
+    refLevel(offset, level, type_exported_name);
+    emitter() << ")";
+}
+
+void output::refThisFrame(int offset)
+{
+    emitter() << "_stk_frame_space." << formFrameSlot(offset);
+}
+
+void output::moveRefThisFrame(int offset)
+{
+    emitter() << "std::move(";
+    refThisFrame(offset);
+    emitter() << ")";
 }
 
 void output::writeOperator(std::string const& op_img)
 {
-    std::cout << " " << op_img << " ";
+    emitter() << " " << op_img << " ";
 }
 
 void output::emptyList()
 {
-    std::cout << emptyListType() << "()";
+    emitter() << emptyListType() << "()";
 }
 
 void output::listBegin(int size, std::string const& member_type_exported_name)
 {
-    std::cout << "_stk_list_builder<" << size << ", " << member_type_exported_name << " >(";
+    emitter() << "_stk_list_builder<" << size << ", " << member_type_exported_name << " >(";
 }
 
 void output::listNextMember()
 {
-    std::cout << ").push(";
+    emitter() << ").push(";
 }
 
 void output::listEnd()
 {
-    std::cout << ").build()";
+    emitter() << ").build()";
+}
+
+void output::staticListBegin(util::id list_id, std::string const& member_type_exported_name)
+{
+    emitter() << "static " << member_type_exported_name << " const "
+              << "_stk_literal_members_" << list_id.str() << "[] = {" << '\n';
+}
+
+void output::staticListMemberEnd()
+{
+    emitter() << "," << '\n';
+}
+
+void output::staticListEnd(util::id list_id, std::string const& member_type_exported_name, int size)
+{
+    emitter() << "};" << '\n';
+    emitter() << "static _stk_static_list_buffer<" << member_type_exported_name << " > "
+              << "_stk_literal_" << list_id.str()
+              << "(_stk_literal_members_" << list_id.str() << ", " << size << ");" << '\n';
+}
+
+void output::staticList(util::id list_id)
+{
+    emitter() << "_stk_literal_" << list_id.str() << ".list()";
 }
 
 void output::memberCallBegin(std::string const& member_name)
 {
-    std::cout << '.' << member_name << '(';
+    emitter() << '.' << member_name << '(';
 }
 
 void output::memberCallEnd()
 {
-    std::cout << ')';
+    emitter() << ')';
 }
 
 void output::listAppendBegin()
 {
-    std::cout << "_stk_list_append(";
+    emitter() << "_stk_list_append(";
 }
 
 void output::listAppendEnd()
 {
-    std::cout << ')';
+    emitter() << ')';
+}
+
+void output::listSliceBegin()
+{
+    emitter() << "_stk_list_range(";
+}
+
+static std::string sliceBoundName(std::string const& op)
+{
+    if ("<" == op) {
+        return "lt";
+    }
+    if ("<=" == op) {
+        return "le";
+    }
+    if (">" == op) {
+        return "gt";
+    }
+    if (">=" == op) {
+        return "ge";
+    }
+    return "eq";
+}
+
+void output::listSliceBound(std::string const& op)
+{
+    emitter() << ")." << sliceBoundName(op) << '(';
+}
+
+void output::listSliceEnd()
+{
+    emitter() << ").slice()";
 }
 
 void output::beginExpr()
 {
-    std::cout << "(";
+    emitter() << "(";
 }
 
 void output::endExpr()
 {
-    std::cout << ")";
+    emitter() << ")";
 }
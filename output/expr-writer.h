@@ -3,6 +3,7 @@
 
 #include <string>
 
+#include <util/pointer.h>
 #include <misc/platform.h>
 
 namespace output {
@@ -12,6 +13,9 @@ namespace output {
     void writeBool(bool b);
 
     void refLevel(int offset, int level, std::string const& type_exported_name);
+    void moveRefLevel(int offset, int level, std::string const& type_exported_name);
+    void refThisFrame(int offset);
+    void moveRefThisFrame(int offset);
     void writeOperator(std::string const& op_img);
 
     void emptyList();
@@ -19,12 +23,21 @@ namespace output {
     void listNextMember();
     void listEnd();
 
+    void staticListBegin(util::id list_id, std::string const& member_type_exported_name);
+    void staticListMemberEnd();
+    void staticListEnd(util::id list_id, std::string const& member_type_exported_name, int size);
+    void staticList(util::id list_id);
+
     void memberCallBegin(std::string const& member_name);
     void memberCallEnd();
 
     void listAppendBegin();
     void listAppendEnd();
 
+    void listSliceBegin();
+    void listSliceBound(std::string const& op);
+    void listSliceEnd();
+
     void beginExpr();
     void endExpr();
 
@@ -1,55 +1,52 @@
-#include <iostream>
 #include <algorithm>
 
 #include <util/string.h>
+#include <misc/options.h>
 
 #include "func-writer.h"
+#include "emitter.h"
 #include "stmt-writer.h"
 #include "expr-writer.h"
 #include "name-mangler.h"
 
 using namespace output;
 
-std::string Parameter::resEntry() const
-{
-    return "";
-}
-
-std::string ResourceParam::resEntry() const
-{
-    return "_res_entries.add(" + util::str(offset) + ");";
-}
-
 static std::string const FUNC_DECL(
     "struct $FUNC_NAME {\n"
-    "    char _stk_frame_space[$FUNC_FRAME_SIZE];\n"
-    "    _stk_frame_bases<$FUNC_LEVEL> _stk_bases;\n"
-    "    _stk_res_entries<$RES_ENTRIES_SIZE> _res_entries;\n"
+    "    _stk_arena _stk_frame_arena;\n"
+    "    $FRAME_TYPE _stk_frame_space;\n"
+    "    typedef _stk_frame_bases<$FUNC_LEVEL$OUTER_LEVELS> _stk_bases_type;\n"
+    "    _stk_bases_type _stk_bases;\n"
     "\n"
-    "    template <int _ExtLevel>\n"
+    "    template <typename _ExtBases>\n"
     "    $FUNC_NAME(\n"
-    "          _stk_frame_bases<_ExtLevel> const& ext_bases\n"
+    "          _ExtBases const& ext_bases\n"
     "          $ARGS_DECL\n"
     "            )\n"
-    "        : _stk_bases(ext_bases, _stk_frame_space)\n"
+    "        : _stk_bases(ext_bases, &_stk_frame_space)\n"
     "    {\n"
+    "        $INIT_RES_SLOTS\n"
     "        $COPY_ARGS\n"
     "    }\n"
     "\n"
     "    $FUNC_NAME()\n"
-    "        : _stk_bases(_stk_frame_space)\n"
-    "    {}\n"
+    "        : _stk_bases(&_stk_frame_space)\n"
+    "    {\n"
+    "        $INIT_RES_SLOTS\n"
+    "    }\n"
     "\n"
     "    $FUNC_RET_TYPE _stk_perform();\n"
     "\n"
     "    ~$FUNC_NAME()\n"
     "    {\n"
-    "        _res_entries.dtor(_stk_frame_space);\n"
+    "        $DESTROY_RES_SLOTS\n"
     "    }\n"
     "};\n"
 );
 
-static std::string const FUNC_PERFORM_IMPL_BEGIN("$FUNC_RET_TYPE $FUNC_NAME::_stk_perform()\n");
+static std::string const FUNC_PERFORM_IMPL_BEGIN("$FUNC_RET_TYPE $FUNC_NAME::_stk_perform()\n{\n");
+static std::string const FUNC_ARENA_SCOPE("    _stk_arena_scope _stk_frame_scope(&_stk_frame_arena);\n");
+static std::string const FUNC_PERFORM_IMPL_END("    return $FUNC_RET_TYPE();\n}\n");
 
 static std::string formArgsDecl(std::vector<util::sptr<StackVarRec const>> const& params)
 {
@@ -74,20 +71,131 @@ static std::string formCopyArgs(std::vector<util::sptr<StackVarRec const>> const
                   {
                       result += "_stk_bases.push("
                               + util::str(record->offset)
-                              + ", _stk_arg_"
+                              + ", std::move(_stk_arg_"
                               + util::str(i++)
-                              + ");"
-                              + record->resEntry();
+                              + "));";
+                  });
+    return result;
+}
+
+static std::string const RES_SLOT_INIT("_stk_res_init<$SLOT_TYPE >(&_stk_frame_space, $SLOT_OFFSET);");
+static std::string const RES_SLOT_DESTROY("_stk_res_destroy<$SLOT_TYPE >(&_stk_frame_space, $SLOT_OFFSET);");
+
+static std::string formResSlot(std::string const& pattern, FrameSlot const& slot)
+{
+    return util::replace_all(
+           util::replace_all(
+               pattern
+                   , "$SLOT_TYPE", slot.type)
+                   , "$SLOT_OFFSET", util::str(slot.offset));
+}
+
+static std::string formInitResSlots(std::vector<FrameSlot> const& res_slots)
+{
+    std::string result;
+    std::for_each(res_slots.begin()
+                , res_slots.end()
+                , [&](FrameSlot const& slot)
+                  {
+                      result += formResSlot(RES_SLOT_INIT, slot);
+                  });
+    return result;
+}
+
+static std::string formDestroyResSlots(std::vector<FrameSlot> const& res_slots)
+{
+    std::string result;
+    std::for_each(res_slots.rbegin()
+                , res_slots.rend()
+                , [&](FrameSlot const& slot)
+                  {
+                      result += formResSlot(RES_SLOT_DESTROY, slot);
                   });
     return result;
 }
 
+static std::string const FRAME_TYPEDEF("typedef char $FRAME_NAME[$FUNC_FRAME_SIZE];\n");
+
+static std::string const FRAME_STRUCT_BEGIN("struct $FRAME_NAME {\n");
+static std::string const FRAME_SLOT(
+    "    union { $SLOT_TYPE $SLOT_NAME; };\n"
+    "    static_assert(sizeof($SLOT_TYPE) == $SLOT_SIZE && $SLOT_OFFSET % alignof($SLOT_TYPE) == 0\n"
+    "                , \"frame slot layout\");\n"
+);
+static std::string const FRAME_PADDING("    char _stk_pad_$PAD_OFFSET[$PAD_SIZE];\n");
+static std::string const FRAME_STRUCT_END(
+    "\n"
+    "    $FRAME_NAME() {}\n"
+    "    ~$FRAME_NAME() {}\n"
+    "};\n"
+);
+
+static std::string formFramePadding(int from, int to)
+{
+    if (from >= to) {
+        return "";
+    }
+    return util::replace_all(
+           util::replace_all(
+               FRAME_PADDING
+                   , "$PAD_OFFSET", util::str(from))
+                   , "$PAD_SIZE", util::str(to - from));
+}
+
+/*
+ * Slots live in anonymous unions so the frame constructs and destructs
+ * nothing by itself; values are still placed and released by offset.
+ */
+static void writeFrameType(util::serial_num func_sn
+                         , std::vector<FrameSlot> const& frame_slots
+                         , int stack_size_used)
+{
+    std::string const frame_name(formFrameName(func_sn));
+    if (!misc::options::get().typed_frame) {
+        emitter() <<
+            util::replace_all(
+            util::replace_all(
+                FRAME_TYPEDEF
+                    , "$FRAME_NAME", frame_name)
+                    , "$FUNC_FRAME_SIZE", util::str(stack_size_used))
+        ;
+        return;
+    }
+
+    emitter() << util::replace_all(FRAME_STRUCT_BEGIN, "$FRAME_NAME", frame_name);
+    int used = 0;
+    std::for_each(frame_slots.begin()
+                , frame_slots.end()
+                , [&](FrameSlot const& slot)
+                  {
+                      if (0 == slot.size) {
+                          return;
+                      }
+                      emitter() << formFramePadding(used, slot.offset) <<
+                          util::replace_all(
+                          util::replace_all(
+                          util::replace_all(
+                          util::replace_all(
+                              FRAME_SLOT
+                                  , "$SLOT_TYPE", slot.type)
+                                  , "$SLOT_NAME", formFrameSlot(slot.offset))
+                                  , "$SLOT_SIZE", util::str(slot.size))
+                                  , "$SLOT_OFFSET", util::str(slot.offset))
+                      ;
+                      used = slot.offset + slot.size;
+                  });
+    emitter() << formFramePadding(used, std::max(stack_size_used, 1))
+              << util::replace_all(FRAME_STRUCT_END, "$FRAME_NAME", frame_name);
+}
+
 void output::writeFuncDecl(std::string const& ret_type_name
                          , util::serial_num func_sn
                          , std::vector<util::sptr<StackVarRec const>> const& params
+                         , std::vector<FrameSlot> const& frame_slots
                          , int func_level
+                         , std::vector<int> const& outer_levels
                          , int stack_size_used
-                         , int res_entry_size)
+                         , std::vector<FrameSlot> const& res_slots)
 {
     std::vector<std::string> typenames;
     std::for_each(params.begin()
@@ -96,7 +204,17 @@ void output::writeFuncDecl(std::string const& ret_type_name
                   {
                       typenames.push_back(record->type);
                   });
-    std::cout <<
+    writeFrameType(func_sn, frame_slots, stack_size_used);
+    std::string outer_levels_list;
+    std::for_each(outer_levels.begin()
+                , outer_levels.end()
+                , [&](int level)
+                  {
+                      outer_levels_list += ", " + util::str(level);
+                  });
+    emitter() <<
+        util::replace_all(
+        util::replace_all(
         util::replace_all(
         util::replace_all(
         util::replace_all(
@@ -107,38 +225,180 @@ void output::writeFuncDecl(std::string const& ret_type_name
             FUNC_DECL
                 , "$FUNC_RET_TYPE", ret_type_name)
                 , "$FUNC_NAME", formFuncName(func_sn))
-                , "$RES_ENTRIES_SIZE", util::str(res_entry_size))
+                , "$INIT_RES_SLOTS", formInitResSlots(res_slots))
+                , "$DESTROY_RES_SLOTS", formDestroyResSlots(res_slots))
                 , "$ARGS_DECL", formArgsDecl(params))
                 , "$COPY_ARGS", formCopyArgs(params))
                 , "$FUNC_LEVEL", util::str(func_level))
-                , "$FUNC_FRAME_SIZE", util::str(stack_size_used))
+                , "$OUTER_LEVELS", outer_levels_list)
+                , "$FRAME_TYPE", formFrameName(func_sn))
     ;
 }
 
 void output::writeFuncImpl(std::string const& ret_type_name, util::serial_num func_sn)
 {
-    std::cout <<
+    emitter() <<
         util::replace_all(
         util::replace_all(
             FUNC_PERFORM_IMPL_BEGIN
                 , "$FUNC_RET_TYPE", ret_type_name)
                 , "$FUNC_NAME", formFuncName(func_sn))
     ;
+    if (misc::options::get().frame_arena) {
+        emitter() << FUNC_ARENA_SCOPE;
+    }
+}
+
+void output::writeFuncImplEnd(std::string const& ret_type_name)
+{
+    emitter() << util::replace_all(FUNC_PERFORM_IMPL_END, "$FUNC_RET_TYPE", ret_type_name);
+}
+
+static std::string const PLAIN_FUNC_SIGNATURE(
+    "$FUNC_RET_TYPE $FUNC_NAME(_stk_plain_bases$ARGS_DECL)"
+);
+static std::string const PLAIN_FUNC_FRAME(
+    "    $FRAME_TYPE _stk_frame_space;\n"
+    "    typedef _stk_frame_bases<$FUNC_LEVEL> _stk_bases_type;\n"
+    "    _stk_bases_type _stk_bases(&_stk_frame_space);\n"
+    "    $COPY_ARGS\n"
+);
+
+static std::string formPlainFuncSignature(std::string const& ret_type_name
+                                        , util::serial_num func_sn
+                                        , std::vector<util::sptr<StackVarRec const>> const& params)
+{
+    return util::replace_all(
+           util::replace_all(
+           util::replace_all(
+               PLAIN_FUNC_SIGNATURE
+                   , "$FUNC_RET_TYPE", ret_type_name)
+                   , "$FUNC_NAME", formFuncName(func_sn))
+                   , "$ARGS_DECL", formArgsDecl(params));
+}
+
+void output::writePlainFuncDecl(std::string const& ret_type_name
+                              , util::serial_num func_sn
+                              , std::vector<util::sptr<StackVarRec const>> const& params
+                              , std::vector<FrameSlot> const& frame_slots
+                              , int stack_size_used)
+{
+    writeFrameType(func_sn, frame_slots, stack_size_used);
+    emitter() << "static inline " << formPlainFuncSignature(ret_type_name, func_sn, params)
+              << ";\n";
+}
+
+void output::writePlainFuncImpl(std::string const& ret_type_name
+                              , util::serial_num func_sn
+                              , std::vector<util::sptr<StackVarRec const>> const& params
+                              , int func_level)
+{
+    emitter() << formPlainFuncSignature(ret_type_name, func_sn, params) << "\n{\n" <<
+        util::replace_all(
+        util::replace_all(
+        util::replace_all(
+            PLAIN_FUNC_FRAME
+                , "$FRAME_TYPE", formFrameName(func_sn))
+                , "$FUNC_LEVEL", util::str(func_level))
+                , "$COPY_ARGS", formCopyArgs(params))
+    ;
+}
+
+static std::string const MEMO_TABLE(
+    "_stk_memo_table<$FUNC_RET_TYPE$PARAM_TYPES > $FUNC_NAME_memo(\"$FUNC_NAME\");\n"
+);
+
+void output::writeMemoTable(std::string const& ret_type_name
+                          , util::serial_num func_sn
+                          , std::vector<util::sptr<StackVarRec const>> const& params)
+{
+    std::string param_types;
+    std::for_each(params.begin()
+                , params.end()
+                , [&](util::sptr<StackVarRec const> const& record)
+                  {
+                      param_types += ", " + record->type;
+                  });
+    emitter() <<
+        util::replace_all(
+        util::replace_all(
+        util::replace_all(
+            MEMO_TABLE
+                , "$FUNC_RET_TYPE", ret_type_name)
+                , "$PARAM_TYPES", param_types)
+                , "$FUNC_NAME", formFuncName(func_sn))
+    ;
+}
+
+void output::writeTailCallEntry()
+{
+    emitter() << "_stk_tail_call:\n";
+}
+
+void output::tailCallBegin()
+{
+    emitter() << "{\n";
+}
+
+void output::tailCallArgBegin(int index, std::string const& type_exported_name)
+{
+    emitter() << type_exported_name << " _stk_arg_" << index << "(";
+}
+
+void output::tailCallArgEnd()
+{
+    emitter() << ");\n";
+}
+
+void output::tailCallEnd(std::vector<util::sptr<StackVarRec const>> const& params
+                       , std::vector<FrameSlot> const& res_slots)
+{
+    emitter() << formDestroyResSlots(res_slots) << formInitResSlots(res_slots) << "\n"
+              << formCopyArgs(params) << "\n"
+              << "goto _stk_tail_call;\n"
+              << "}\n";
 }
 
 void output::writeCallBegin(util::serial_num func_sn)
 {
-    std::cout << "(" << formFuncName(func_sn) << "(_stk_bases";
+    emitter() << "(" << formFuncName(func_sn) << "(_stk_bases";
+}
+
+void output::writeMemoCallBegin(util::serial_num func_sn)
+{
+    std::string const func_name(formFuncName(func_sn));
+    emitter() << "(_stk_memo_call<" << func_name << ">(" << func_name << "_memo, _stk_bases";
+}
+
+void output::writeMemoCallEnd()
+{
+    emitter() << "))";
+}
+
+void output::writePlainCallBegin(util::serial_num func_sn)
+{
+    emitter() << "(" << formFuncName(func_sn) << "(_stk_plain_bases()";
+}
+
+void output::writePlainCallEnd()
+{
+    emitter() << "))";
+}
+
+void output::writePlainMemoCallBegin(util::serial_num func_sn)
+{
+    std::string const func_name(formFuncName(func_sn));
+    emitter() << "(_stk_memo_call(" << func_name << "_memo, " << func_name << ", _stk_plain_bases()";
 }
 
 void output::writeArgSeparator()
 {
-    std::cout << ", ";
+    emitter() << ", ";
 }
 
 void output::writeCallEnd()
 {
-    std::cout << ")._stk_perform())";
+    emitter() << ")._stk_perform())";
 }
 
 static std::string const MAIN_BEGIN(
@@ -153,143 +413,379 @@ static std::string const MAIN_END(
 
 void output::writeMainBegin()
 {
-    std::cout << MAIN_BEGIN;
+    emitter() << MAIN_BEGIN;
 }
 
 void output::writeMainEnd()
 {
-    std::cout << MAIN_END << std::endl;
+    emitter() << MAIN_END << '\n';
 }
 
 void output::stknMainFunc(util::serial_num func_sn)
 {
-    std::cout << "    " << formFuncName(func_sn) << "()._stk_perform();" << std::endl;
+    emitter() << "    " << formFuncName(func_sn) << "()._stk_perform();" << '\n';
 }
 
 void output::writeFuncReference(int size)
 {
-    std::cout << formFuncReferenceType(size) << "()";
+    emitter() << formFuncReferenceType(size) << "()";
 }
 
 void output::funcReferenceNextVariable(int offset, util::sptr<StackVarRec const> init)
 {
-    std::cout << (".push(" + util::str(offset) + ", ");
+    emitter() << (".push(" + util::str(offset) + ", ");
     refLevel(init->offset, init->level, init->type);
-    std::cout << ')';
+    emitter() << ')';
 }
 
-static std::string const PIPE_MAP_BEGIN(
+static std::string const PIPELINE_BEGIN(
 "struct _stk_pipe_$PIPE_ID {\n"
-"    _stk_frame_bases<$LEVEL> _stk_bases;\n"
+"    _stk_bases_type _stk_bases;\n"
 "\n"
-"    explicit _stk_pipe_$PIPE_ID(_stk_frame_bases<$LEVEL> const& cp_bases)\n"
+"    explicit _stk_pipe_$PIPE_ID(_stk_bases_type const& cp_bases)\n"
 "        : _stk_bases(cp_bases)\n"
 "    {}\n"
 "\n"
 "    _stk_list<$DST_MEMBER_TYPE > _stk_perform(_stk_list<$SRC_MEMBER_TYPE > const& src)\n"
 "    {\n"
-"        _stk_list<$DST_MEMBER_TYPE > result(src._size);\n"
-"        result._size = src._size;\n"
-"        for (_stk_type_int _stk_index = 0; _stk_index < src._size; ++_stk_index) {\n"
-"            result._members[_stk_index] = (\n"
+"        return _stk_run_pipe<$DST_MEMBER_TYPE, $PARALLEL>(*this, src);\n"
+"    }\n"
+"\n"
+"    _stk_type_int _stk_chunk(_stk_list<$SRC_MEMBER_TYPE > const& src\n"
+"                           , _stk_type_int _stk_begin\n"
+"                           , _stk_type_int _stk_end\n"
+"                           , $DST_MEMBER_TYPE* _stk_dst)\n"
+"    {\n"
+"        _stk_type_int _stk_result_size = 0;\n"
 );
 
-static std::string const PIPE_MAP_END(
-"                                           );\n"
+static std::string const PIPELINE_LOOP_BEGIN(
+"        for (_stk_type_int _stk_src_index = _stk_begin; _stk_src_index < _stk_end; ++_stk_src_index) {\n"
+"            $SRC_MEMBER_TYPE const& _stk_element = src._members[_stk_src_index];\n"
+);
+
+static std::string const PIPELINE_LOOP_INDEX(
+"            _stk_type_int const _stk_index = _stk_src_index;\n"
+);
+
+static std::string const PIPELINE_LOOP_END(
+"            _stk_dst[_stk_result_size++] = _stk_element;\n"
+);
+
+static std::string const PIPELINE_END(
 "        }\n"
-"        return result;\n"
+"        return _stk_result_size;\n"
 "    }\n"
 "};\n"
 );
 
-void output::pipeMapBegin(util::id pipe_id
-                        , int level
-                        , std::string const& src_member_type
-                        , std::string const& dst_member_type)
+void output::pipelineBegin(util::id pipe_id
+                         , std::string const& src_member_type
+                         , std::string const& dst_member_type
+                         , bool parallel)
 {
-    std::cout <<
+    emitter() <<
         util::replace_all(
         util::replace_all(
         util::replace_all(
         util::replace_all(
-            PIPE_MAP_BEGIN
+            PIPELINE_BEGIN
                 , "$PIPE_ID", pipe_id.str())
-                , "$LEVEL", util::str(level))
                 , "$SRC_MEMBER_TYPE", src_member_type)
                 , "$DST_MEMBER_TYPE", dst_member_type)
+                , "$PARALLEL", parallel ? "true" : "false")
     ;
 }
 
-void output::pipeMapEnd()
+void output::pipelineLoopBegin(std::string const& src_member_type, bool index_read)
 {
-    std::cout << PIPE_MAP_END;
+    emitter() << util::replace_all(PIPELINE_LOOP_BEGIN, "$SRC_MEMBER_TYPE", src_member_type);
+    if (index_read) {
+        emitter() << PIPELINE_LOOP_INDEX;
+    }
 }
 
+void output::pipelineLoopEnd()
+{
+    emitter() << PIPELINE_LOOP_END;
+}
+
+void output::pipelineEnd()
+{
+    emitter() << PIPELINE_END;
+}
+
+static std::string const PIPE_MAP_BEGIN(
+"            $DST_MEMBER_TYPE _stk_mapped_$PIPE_ID = (\n"
+);
+
+static std::string const PIPE_MAP_END(
+"                                           );\n"
+"            {\n"
+"            $DST_MEMBER_TYPE const& _stk_element = _stk_mapped_$PIPE_ID;\n"
+);
+
+void output::pipeMapBegin(util::id pipe_id, std::string const& dst_member_type)
+{
+    emitter() <<
+        util::replace_all(
+        util::replace_all(
+            PIPE_MAP_BEGIN
+                , "$PIPE_ID", pipe_id.str())
+                , "$DST_MEMBER_TYPE", dst_member_type)
+    ;
+}
+
+void output::pipeMapEnd(util::id pipe_id, std::string const& dst_member_type)
+{
+    emitter() <<
+        util::replace_all(
+        util::replace_all(
+            PIPE_MAP_END
+                , "$PIPE_ID", pipe_id.str())
+                , "$DST_MEMBER_TYPE", dst_member_type)
+    ;
+}
+
+static std::string const PIPE_FILTER_COUNTER(
+"        _stk_type_int _stk_passed_$PIPE_ID = 0;\n"
+);
+
 static std::string const PIPE_FILTER_BEGIN(
+"            if (!(\n"
+);
+
+static std::string const PIPE_FILTER_END(
+"                )) {\n"
+"                continue;\n"
+"            }\n"
+"            {\n"
+);
+
+static std::string const PIPE_FILTER_INDEX(
+"            _stk_type_int const _stk_index = _stk_passed_$PIPE_ID++;\n"
+);
+
+void output::pipeFilterCounter(util::id pipe_id)
+{
+    emitter() << util::replace_all(PIPE_FILTER_COUNTER, "$PIPE_ID", pipe_id.str());
+}
+
+void output::pipeFilterBegin()
+{
+    emitter() << PIPE_FILTER_BEGIN;
+}
+
+void output::pipeFilterEnd(util::id pipe_id, bool index_read)
+{
+    emitter() << PIPE_FILTER_END;
+    if (index_read) {
+        emitter() << util::replace_all(PIPE_FILTER_INDEX, "$PIPE_ID", pipe_id.str());
+    }
+}
+
+void output::pipeStageEnd()
+{
+    emitter() << "            }\n";
+}
+
+static std::string const PIPE_BEGIN("_stk_pipe_$PIPE_ID(_stk_bases)._stk_perform(");
+static std::string const PIPE_END(")");
+
+void output::pipeBegin(util::id pipe_id)
+{
+    emitter() << util::replace_all(PIPE_BEGIN, "$PIPE_ID", pipe_id.str());
+}
+
+void output::pipeEnd()
+{
+    emitter() << PIPE_END;
+}
+
+void output::pipeElement()
+{
+    emitter() << "_stk_element";
+}
+
+void output::pipeIndex()
+{
+    emitter() << "_stk_index";
+}
+
+static std::string const PIPE_KERNEL_BEGIN(
 "struct _stk_pipe_$PIPE_ID {\n"
-"    _stk_frame_bases<$LEVEL> _stk_bases;\n"
+"    _stk_bases_type _stk_bases;\n"
 "\n"
-"    explicit _stk_pipe_$PIPE_ID(_stk_frame_bases<$LEVEL> const& cp_bases)\n"
+"    explicit _stk_pipe_$PIPE_ID(_stk_bases_type const& cp_bases)\n"
 "        : _stk_bases(cp_bases)\n"
 "    {}\n"
 "\n"
 "    _stk_list<$MEMBER_TYPE > _stk_perform(_stk_list<$MEMBER_TYPE > const& src)\n"
 "    {\n"
-"        _stk_list<$MEMBER_TYPE > result(src._size);\n"
-"        _stk_type_int cursor = 0;\n"
-"        for (_stk_type_int _stk_index = 0; _stk_index < src._size; ++_stk_index) {\n"
-"            if (\n"
+"        return _stk_run_pipe<$MEMBER_TYPE, $PARALLEL>(*this, src);\n"
+"    }\n"
+"\n"
+"    _stk_type_int _stk_chunk(_stk_list<$MEMBER_TYPE > const& src\n"
+"                           , _stk_type_int _stk_begin\n"
+"                           , _stk_type_int _stk_end\n"
+"                           , $MEMBER_TYPE* _stk_dst)\n"
+"    {\n"
+"        if (_stk_end <= _stk_begin) {\n"
+"            return 0;\n"
+"        }\n"
+"        $MEMBER_TYPE const* const _stk_src = src._members;\n"
 );
 
-static std::string const PIPE_FILTER_END(
-"                ) {\n"
-"                result._members[cursor] = src._members[_stk_index];\n"
-"                ++cursor;\n"
-"            }\n"
-"        }\n"
-"        result._size = cursor;\n"
-"        return result;\n"
+static std::string const PIPE_KERNEL_INVARIANT_BEGIN(
+"        $MEMBER_TYPE const _stk_scalar_$INDEX = (\n"
+);
+
+static std::string const PIPE_KERNEL_INVARIANT_END(
+"                                           );\n"
+"        $SIMD_TYPE _stk_splat_$INDEX;\n"
+"        _stk_simd<$MEMBER_TYPE >::splat(_stk_splat_$INDEX, _stk_scalar_$INDEX);\n"
+);
+
+static std::string const PIPE_KERNEL_VECTOR_INDEX_INIT(
+"        $SIMD_TYPE _stk_next_index;\n"
+"        _stk_simd<$MEMBER_TYPE >::iota(_stk_next_index, _stk_begin);\n"
+"        $SIMD_TYPE _stk_index_step;\n"
+"        _stk_simd<$MEMBER_TYPE >::splat(_stk_index_step, _stk_simd<$MEMBER_TYPE >::width);\n"
+);
+
+static std::string const PIPE_KERNEL_VECTOR_LOOP_BEGIN(
+"        _stk_type_int _stk_src_index = _stk_begin;\n"
+"        for (; _stk_src_index + _stk_simd<$MEMBER_TYPE >::width <= _stk_end\n"
+"             ; _stk_src_index += _stk_simd<$MEMBER_TYPE >::width)\n"
+"        {\n"
+"            $SIMD_TYPE _stk_element;\n"
+"            _stk_simd<$MEMBER_TYPE >::load(_stk_element, _stk_src + _stk_src_index);\n"
+);
+
+static std::string const PIPE_KERNEL_VECTOR_INDEX(
+"            $SIMD_TYPE const _stk_index = _stk_next_index;\n"
+"            _stk_next_index += _stk_index_step;\n"
+);
+
+static std::string const PIPE_KERNEL_VECTOR_INVARIANT(
+"            $SIMD_TYPE const& _stk_invariant_$INDEX = _stk_splat_$INDEX;\n"
+);
+
+static std::string const PIPE_KERNEL_VECTOR_LOOP_END(
+"            _stk_simd<$MEMBER_TYPE >::store(_stk_dst + (_stk_src_index - _stk_begin), _stk_element);\n"
+);
+
+static std::string const PIPE_KERNEL_SCALAR_LOOP_BEGIN(
+"        for (; _stk_src_index < _stk_end; ++_stk_src_index) {\n"
+"            $MEMBER_TYPE const _stk_element = _stk_src[_stk_src_index];\n"
+);
+
+static std::string const PIPE_KERNEL_SCALAR_INDEX(
+"            _stk_type_int const _stk_index = _stk_src_index;\n"
+);
+
+static std::string const PIPE_KERNEL_SCALAR_INVARIANT(
+"            $MEMBER_TYPE const _stk_invariant_$INDEX = _stk_scalar_$INDEX;\n"
+);
+
+static std::string const PIPE_KERNEL_SCALAR_LOOP_END(
+"            _stk_dst[_stk_src_index - _stk_begin] = _stk_element;\n"
+);
+
+static std::string const PIPE_KERNEL_END(
+"        return _stk_end - _stk_begin;\n"
 "    }\n"
 "};\n"
 );
 
-void output::pipeFilterBegin(util::id pipe_id, int level, std::string const& member_type)
+static std::string formKernelPart(std::string const& part
+                                , std::string const& member_type
+                                , int index)
+{
+    return util::replace_all(
+           util::replace_all(
+           util::replace_all(
+                part
+                    , "$SIMD_TYPE", formSimdType(member_type))
+                    , "$MEMBER_TYPE", member_type)
+                    , "$INDEX", util::str(index));
+}
+
+void output::pipeKernelBegin(util::id pipe_id
+                           , std::string const& member_type
+                           , bool parallel)
 {
-    std::cout <<
+    emitter() <<
         util::replace_all(
         util::replace_all(
         util::replace_all(
-            PIPE_FILTER_BEGIN
+            PIPE_KERNEL_BEGIN
                 , "$PIPE_ID", pipe_id.str())
-                , "$LEVEL", util::str(level))
                 , "$MEMBER_TYPE", member_type)
+                , "$PARALLEL", parallel ? "true" : "false")
     ;
 }
 
-void output::pipeFilterEnd()
+void output::pipeKernelInvariantBegin(int index, std::string const& member_type)
 {
-    std::cout << PIPE_FILTER_END;
+    emitter() << formKernelPart(PIPE_KERNEL_INVARIANT_BEGIN, member_type, index);
 }
 
-static std::string const PIPE_BEGIN("_stk_pipe_$PIPE_ID(_stk_bases)._stk_perform(");
-static std::string const PIPE_END(")");
+void output::pipeKernelInvariantEnd(int index, std::string const& member_type)
+{
+    emitter() << formKernelPart(PIPE_KERNEL_INVARIANT_END, member_type, index);
+}
 
-void output::pipeBegin(util::id pipe_id)
+void output::pipeKernelVectorLoopBegin(std::string const& member_type, bool index_read)
 {
-    std::cout << util::replace_all(PIPE_BEGIN, "$PIPE_ID", pipe_id.str());
+    if (index_read) {
+        emitter() << formKernelPart(PIPE_KERNEL_VECTOR_INDEX_INIT, member_type, 0);
+    }
+    emitter() << formKernelPart(PIPE_KERNEL_VECTOR_LOOP_BEGIN, member_type, 0);
+    if (index_read) {
+        emitter() << formKernelPart(PIPE_KERNEL_VECTOR_INDEX, member_type, 0);
+    }
 }
 
-void output::pipeEnd()
+void output::pipeKernelVectorInvariant(int index, std::string const& member_type)
 {
-    std::cout << PIPE_END;
+    emitter() << formKernelPart(PIPE_KERNEL_VECTOR_INVARIANT, member_type, index);
 }
 
-void output::pipeElement()
+void output::pipeKernelVectorLoopEnd(std::string const& member_type)
 {
-    std::cout << "src._members[_stk_index]";
+    emitter() << formKernelPart(PIPE_KERNEL_VECTOR_LOOP_END, member_type, 0);
 }
 
-void output::pipeIndex()
+void output::pipeKernelScalarLoopBegin(std::string const& member_type, bool index_read)
+{
+    emitter() << formKernelPart(PIPE_KERNEL_SCALAR_LOOP_BEGIN, member_type, 0);
+    if (index_read) {
+        emitter() << formKernelPart(PIPE_KERNEL_SCALAR_INDEX, member_type, 0);
+    }
+}
+
+void output::pipeKernelScalarInvariant(int index, std::string const& member_type)
+{
+    emitter() << formKernelPart(PIPE_KERNEL_SCALAR_INVARIANT, member_type, index);
+}
+
+void output::pipeKernelScalarLoopEnd()
+{
+    emitter() << PIPE_KERNEL_SCALAR_LOOP_END;
+}
+
+void output::pipeKernelLoopClose()
+{
+    emitter() << "        }\n";
+}
+
+void output::pipeKernelEnd()
+{
+    emitter() << PIPE_KERNEL_END;
+}
+
+void output::pipeKernelInvariant(int index)
 {
-    std::cout << "_stk_index";
+    emitter() << "_stk_invariant_" << index;
 }
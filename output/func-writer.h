@@ -12,7 +12,6 @@ namespace output {
 
     struct StackVarRec {
         virtual ~StackVarRec() {}
-        virtual std::string resEntry() const = 0;
 
         StackVarRec(std::string const& t, int o, int l)
             : type(t)
@@ -31,30 +30,59 @@ namespace output {
         Parameter(std::string const& type, int offset, int level)
             : StackVarRec(type, offset, level)
         {}
-
-        std::string resEntry() const;
     };
 
-    struct ResourceParam
-        : public StackVarRec
-    {
-        ResourceParam(std::string const& type, int offset, int level)
-            : StackVarRec(type, offset, level)
+    struct FrameSlot {
+        FrameSlot(std::string const& t, int o, int s)
+            : type(t)
+            , offset(o)
+            , size(s)
         {}
 
-        std::string resEntry() const;
+        std::string const type;
+        int const offset;
+        int const size;
     };
 
     void writeFuncDecl(std::string const& ret_type_name
                      , util::serial_num func_sn
                      , std::vector<util::sptr<StackVarRec const>> const& params
+                     , std::vector<FrameSlot> const& frame_slots
                      , int func_level
+                     , std::vector<int> const& outer_levels
                      , int stack_size_used
-                     , int res_entry_size);
+                     , std::vector<FrameSlot> const& res_slots);
     void writeFuncImpl(std::string const& ret_type_name, util::serial_num func_sn);
+    void writeFuncImplEnd(std::string const& ret_type_name);
+
+    void writePlainFuncDecl(std::string const& ret_type_name
+                          , util::serial_num func_sn
+                          , std::vector<util::sptr<StackVarRec const>> const& params
+                          , std::vector<FrameSlot> const& frame_slots
+                          , int stack_size_used);
+    void writePlainFuncImpl(std::string const& ret_type_name
+                          , util::serial_num func_sn
+                          , std::vector<util::sptr<StackVarRec const>> const& params
+                          , int func_level);
+
+    void writeTailCallEntry();
+    void tailCallBegin();
+    void tailCallArgBegin(int index, std::string const& type_exported_name);
+    void tailCallArgEnd();
+    void tailCallEnd(std::vector<util::sptr<StackVarRec const>> const& params
+                   , std::vector<FrameSlot> const& res_slots);
+
+    void writeMemoTable(std::string const& ret_type_name
+                      , util::serial_num func_sn
+                      , std::vector<util::sptr<StackVarRec const>> const& params);
 
     void writeCallBegin(util::serial_num func_sn);
     void writeCallEnd();
+    void writeMemoCallBegin(util::serial_num func_sn);
+    void writeMemoCallEnd();
+    void writePlainCallBegin(util::serial_num func_sn);
+    void writePlainCallEnd();
+    void writePlainMemoCallBegin(util::serial_num func_sn);
     void writeArgSeparator();
 
     void writeMainBegin();
@@ -64,13 +92,35 @@ namespace output {
     void writeFuncReference(int size);
     void funcReferenceNextVariable(int offset, util::sptr<StackVarRec const> init);
 
-    void pipeMapBegin(util::id pipe_id
-                    , int level
-                    , std::string const& src_member_type
-                    , std::string const& dst_member_type);
-    void pipeMapEnd();
-    void pipeFilterBegin(util::id pipe_id, int level, std::string const& member_type);
-    void pipeFilterEnd();
+    void pipelineBegin(util::id pipe_id
+                     , std::string const& src_member_type
+                     , std::string const& dst_member_type
+                     , bool parallel);
+    void pipelineLoopBegin(std::string const& src_member_type, bool index_read);
+    void pipelineLoopEnd();
+    void pipelineEnd();
+
+    void pipeMapBegin(util::id pipe_id, std::string const& dst_member_type);
+    void pipeMapEnd(util::id pipe_id, std::string const& dst_member_type);
+    void pipeFilterCounter(util::id pipe_id);
+    void pipeFilterBegin();
+    void pipeFilterEnd(util::id pipe_id, bool index_read);
+    void pipeStageEnd();
+
+    void pipeKernelBegin(util::id pipe_id
+                       , std::string const& member_type
+                       , bool parallel);
+    void pipeKernelInvariantBegin(int index, std::string const& member_type);
+    void pipeKernelInvariantEnd(int index, std::string const& member_type);
+    void pipeKernelVectorLoopBegin(std::string const& member_type, bool index_read);
+    void pipeKernelVectorInvariant(int index, std::string const& member_type);
+    void pipeKernelVectorLoopEnd(std::string const& member_type);
+    void pipeKernelScalarLoopBegin(std::string const& member_type, bool index_read);
+    void pipeKernelScalarInvariant(int index, std::string const& member_type);
+    void pipeKernelScalarLoopEnd();
+    void pipeKernelLoopClose();
+    void pipeKernelEnd();
+    void pipeKernelInvariant(int index);
 
     void pipeBegin(util::id pipe_id);
     void pipeEnd();
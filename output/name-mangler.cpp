@@ -7,6 +7,16 @@ std::string output::formFuncName(util::serial_num func_sn)
     return "_stk_func_template_" + util::str(func_sn.n);
 }
 
+std::string output::formFrameName(util::serial_num func_sn)
+{
+    return "_stk_frame_template_" + util::str(func_sn.n);
+}
+
+std::string output::formFrameSlot(int offset)
+{
+    return "_stk_slot_" + util::str(offset);
+}
+
 std::string output::formType(std::string const& type_name)
 {
     return "_stk_type_" + type_name;
@@ -26,3 +36,8 @@ std::string output::formFuncReferenceType(int size)
 {
     return "_stk_composite<" + util::str(size) + '>';
 }
+
+std::string output::formSimdType(std::string const& member_type_exported_name)
+{
+    return "_stk_simd<" + member_type_exported_name + " >::vector";
+}
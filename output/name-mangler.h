@@ -9,10 +9,13 @@
 namespace output {
 
     std::string formFuncName(util::serial_num func_sn);
+    std::string formFrameName(util::serial_num func_sn);
+    std::string formFrameSlot(int offset);
     std::string formType(std::string const& type);
     std::string formListType(std::string const& member_type_exported_name);
     std::string emptyListType();
     std::string formFuncReferenceType(int size);
+    std::string formSimdType(std::string const& member_type_exported_name);
 
 }
 
@@ -19,362 +19,1742 @@ struct _stk_type_bool {
         return boolean;
     }
 
-    _stk_type_bool(bool b)
+    constexpr _stk_type_bool(bool b)
         : boolean(b)
     {}
 
-    _stk_type_bool()
+    constexpr _stk_type_bool()
         : boolean(false)
     {}
 };
 
-struct _stk_res_entry {
-    virtual ~_stk_res_entry() {}
-    virtual void init(void* dst_mem) = 0;
+/*
+ * List memory is bump-allocated from the arena of the innermost call frame
+ * being performed.  Every block records the chunk it lives in, NULL for heap
+ * blocks, and every chunk counts its live blocks: when the frame ends, idle
+ * chunks are freed at once and each of the others is freed with the last of
+ * its blocks that escaped the frame.  Return values are evaluated outside the
+ * arena and threads performing no frame allocate from the heap.
+ */
+_stk_type_int const _stk_arena_align = 16;
+_stk_type_int const _stk_arena_first_chunk_size = 1024;
+_stk_type_int const _stk_arena_max_chunk_size = 65536;
+_stk_type_int const _stk_arena_max_block_size = _stk_arena_max_chunk_size / 4;
+
+#ifdef STKN_ALLOC_STATS
+struct _stk_alloc_stats {
+    unsigned long arena_blocks;
+    unsigned long heap_blocks;
+    unsigned long chunks;
+    unsigned long extended_blocks;
+
+    _stk_alloc_stats()
+        : arena_blocks(0)
+        , heap_blocks(0)
+        , chunks(0)
+        , extended_blocks(0)
+    {}
+
+    ~_stk_alloc_stats()
+    {
+        std::cerr << "arena blocks: " << arena_blocks << std::endl;
+        std::cerr << "heap blocks: " << heap_blocks << std::endl;
+        std::cerr << "arena chunks: " << chunks << std::endl;
+        std::cerr << "blocks extended: " << extended_blocks << std::endl;
+    }
+
+    static _stk_alloc_stats& get()
+    {
+        static _stk_alloc_stats stats;
+        return stats;
+    }
+};
+# define _STK_COUNT_ALLOC(counter) (++_stk_alloc_stats::get().counter)
+#else
+# define _STK_COUNT_ALLOC(counter)
+#endif
+
+_stk_type_int _stk_arena_round(_stk_type_int bytes)
+{
+    return (bytes + _stk_arena_align - 1) & ~(_stk_arena_align - 1);
+}
+
+struct _stk_arena_chunk {
+    _stk_arena_chunk* const next;
+    _stk_type_int const capacity;
+    _stk_type_int used;
+    _stk_type_int live;
+    bool orphaned;
+
+    _stk_arena_chunk(_stk_arena_chunk* n, _stk_type_int cap)
+        : next(n)
+        , capacity(cap)
+        , used(0)
+        , live(0)
+        , orphaned(false)
+    {}
+
+    char* space()
+    {
+        return reinterpret_cast<char*>(this) + _stk_arena_round(sizeof(_stk_arena_chunk));
+    }
+};
+
+/*
+ * Chunks of frames ended are kept for the next frames by capacity instead of
+ * going back to the heap, as each frame would otherwise allocate its own.
+ */
+int const _stk_arena_chunk_classes = 7;
+int const _stk_arena_chunk_class_cached = 16;
+
+struct _stk_arena_chunk_cache {
+    void* chunks[_stk_arena_chunk_classes][_stk_arena_chunk_class_cached];
+    int counts[_stk_arena_chunk_classes];
+
+    _stk_arena_chunk_cache()
+    {
+        std::fill(counts, counts + _stk_arena_chunk_classes, 0);
+    }
+
+    ~_stk_arena_chunk_cache()
+    {
+        for (int c = 0; c < _stk_arena_chunk_classes; ++c) {
+            while (0 != counts[c]) {
+                ::operator delete(chunks[c][--counts[c]]);
+            }
+        }
+    }
+
+    static _stk_arena_chunk_cache& get()
+    {
+        static thread_local _stk_arena_chunk_cache cache;
+        return cache;
+    }
+
+    static int classOf(_stk_type_int cap)
+    {
+        int c = 0;
+        while (_stk_arena_first_chunk_size << c < cap) {
+            ++c;
+        }
+        return c;
+    }
+
+    static void* alloc(_stk_type_int cap)
+    {
+        _stk_arena_chunk_cache& cache = get();
+        int c = classOf(cap);
+        if (0 != cache.counts[c]) {
+            return cache.chunks[c][--cache.counts[c]];
+        }
+        _STK_COUNT_ALLOC(chunks);
+        return ::operator new(_stk_arena_round(sizeof(_stk_arena_chunk)) + cap);
+    }
+
+    static void free(_stk_arena_chunk* chunk)
+    {
+        _stk_arena_chunk_cache& cache = get();
+        int c = classOf(chunk->capacity);
+        if (_stk_arena_chunk_class_cached == cache.counts[c]) {
+            ::operator delete(chunk);
+            return;
+        }
+        cache.chunks[c][cache.counts[c]++] = chunk;
+    }
+};
+
+struct _stk_arena {
+    _stk_arena_chunk* chunks;
+
+    _stk_arena()
+        : chunks(NULL)
+    {}
+
+    ~_stk_arena()
+    {
+        while (NULL != chunks) {
+            _stk_arena_chunk* chunk = chunks;
+            chunks = chunk->next;
+            if (0 == chunk->live) {
+                _stk_arena_chunk_cache::free(chunk);
+            } else {
+                chunk->orphaned = true;
+            }
+        }
+    }
+
+    char* alloc(_stk_type_int bytes)
+    {
+        if (NULL == chunks || chunks->used + bytes > chunks->capacity) {
+            grow(bytes);
+        }
+        char* block = chunks->space() + chunks->used;
+        chunks->used += bytes;
+        ++chunks->live;
+        *reinterpret_cast<_stk_arena_chunk**>(block) = chunks;
+        return block;
+    }
+
+    void grow(_stk_type_int bytes)
+    {
+        _stk_type_int cap = NULL == chunks ? _stk_arena_first_chunk_size
+                                           : std::min(chunks->capacity * 2
+                                                    , _stk_arena_max_chunk_size);
+        while (cap < bytes) {
+            cap *= 2;
+        }
+        chunks = new(_stk_arena_chunk_cache::alloc(cap)) _stk_arena_chunk(chunks, cap);
+    }
+private:
+    _stk_arena(_stk_arena const&);
+};
+
+thread_local _stk_arena* _stk_current_arena = NULL;
+
+struct _stk_arena_scope {
+    _stk_arena* const outer;
+
+    explicit _stk_arena_scope(_stk_arena* arena)
+        : outer(_stk_current_arena)
+    {
+        _stk_current_arena = arena;
+    }
+
+    ~_stk_arena_scope()
+    {
+        _stk_current_arena = outer;
+    }
+};
+
+void* _stk_alloc(_stk_type_int bytes)
+{
+    bytes = _stk_arena_align + _stk_arena_round(bytes);
+    char* block;
+    if (NULL == _stk_current_arena || bytes > _stk_arena_max_block_size) {
+        _STK_COUNT_ALLOC(heap_blocks);
+        block = static_cast<char*>(::operator new(bytes));
+        *reinterpret_cast<_stk_arena_chunk**>(block) = NULL;
+    } else {
+        _STK_COUNT_ALLOC(arena_blocks);
+        block = _stk_current_arena->alloc(bytes);
+    }
+    return block + _stk_arena_align;
+}
+
+void _stk_free(void* p)
+{
+    char* block = static_cast<char*>(p) - _stk_arena_align;
+    _stk_arena_chunk* chunk = *reinterpret_cast<_stk_arena_chunk**>(block);
+    if (NULL == chunk) {
+        ::operator delete(block);
+    } else if (0 == --chunk->live) {
+        if (chunk->orphaned) {
+            _stk_arena_chunk_cache::free(chunk);
+        } else {
+            chunk->used = 0;
+        }
+    }
+}
+
+/*
+ * Grows a block in place when it is the last one taken from its chunk and the
+ * chunk has room for the rest, so that whatever is in it stays where it is.
+ */
+bool _stk_extend(void* p, _stk_type_int bytes, _stk_type_int new_bytes)
+{
+    char* block = static_cast<char*>(p) - _stk_arena_align;
+    _stk_arena_chunk* chunk = *reinterpret_cast<_stk_arena_chunk**>(block);
+    if (NULL == chunk || chunk->orphaned) {
+        return false;
+    }
+    _stk_type_int begin = block - chunk->space();
+    _stk_type_int end = begin + _stk_arena_align + _stk_arena_round(bytes);
+    _stk_type_int new_end = begin + _stk_arena_align + _stk_arena_round(new_bytes);
+    if (end != chunk->used || new_end > chunk->capacity) {
+        return false;
+    }
+    _STK_COUNT_ALLOC(extended_blocks);
+    chunk->used = new_end;
+    return true;
+}
+
+template <int _Size> struct _stk_composite;
+
+/*
+ * Members of these types are plain bytes: their slots are left uninitialized
+ * until written, and they are copied in bulk rather than one by one.
+ */
+template <typename _MemberType>
+struct _stk_trivial_member {
+    static bool const value = false;
+};
+
+template <>
+struct _stk_trivial_member<_stk_type_int> {
+    static bool const value = true;
+};
+
+template <>
+struct _stk_trivial_member<_stk_type_float> {
+    static bool const value = true;
+};
+
+template <>
+struct _stk_trivial_member<_stk_type_bool> {
+    static bool const value = true;
+};
+
+template <int _Size>
+struct _stk_trivial_member<_stk_composite<_Size> > {
+    static bool const value = true;
+};
+
+template <bool _Trivial>
+struct _stk_members {
+    template <typename _MemberType>
+    static void construct(_MemberType* members, _stk_type_int count)
+    {
+        for (_stk_type_int i = 0; i < count; ++i) {
+            new(members + i) _MemberType;
+        }
+    }
+
+    template <typename _MemberType>
+    static void destruct(_MemberType* members, _stk_type_int count)
+    {
+        for (_stk_type_int i = 0; i < count; ++i) {
+            members[i].~_MemberType();
+        }
+    }
+
+    template <typename _MemberType>
+    static _MemberType* copy(_MemberType const* begin, _MemberType const* end, _MemberType* dst)
+    {
+        return std::copy(begin, end, dst);
+    }
+};
+
+template <>
+struct _stk_members<true> {
+    template <typename _MemberType>
+    static void construct(_MemberType*, _stk_type_int) {}
+
+    template <typename _MemberType>
+    static void destruct(_MemberType*, _stk_type_int) {}
+
+    template <typename _MemberType>
+    static _MemberType* copy(_MemberType const* begin, _MemberType const* end, _MemberType* dst)
+    {
+        if (begin == end) {
+            return dst;
+        }
+        __builtin_memcpy(static_cast<void*>(dst), begin, (end - begin) * sizeof(_MemberType));
+        return dst + (end - begin);
+    }
+};
+
+template <typename _MemberType>
+_MemberType* _stk_copy_members(_MemberType const* begin, _MemberType const* end, _MemberType* dst)
+{
+    return _stk_members<_stk_trivial_member<_MemberType>::value>::copy(begin, end, dst);
+}
+
+template <typename _MemberType>
+_MemberType* _stk_new_members(_stk_type_int count)
+{
+    _MemberType* members = static_cast<_MemberType*>(_stk_alloc(count * sizeof(_MemberType)));
+    _stk_members<_stk_trivial_member<_MemberType>::value>::construct(members, count);
+    return members;
+}
+
+template <typename _MemberType>
+bool _stk_extend_members(_MemberType* members, _stk_type_int count, _stk_type_int new_count)
+{
+    if (!_stk_extend(members, count * sizeof(_MemberType), new_count * sizeof(_MemberType))) {
+        return false;
+    }
+    _stk_members<_stk_trivial_member<_MemberType>::value>::construct(members + count
+                                                                    , new_count - count);
+    return true;
+}
+
+template <typename _MemberType>
+void _stk_delete_members(_MemberType* members, _stk_type_int count)
+{
+    if (NULL == members) {
+        return;
+    }
+    _stk_members<_stk_trivial_member<_MemberType>::value>::destruct(members, count);
+    _stk_free(members);
+}
+
+struct _stk_arena_object {
+    static void* operator new(size_t bytes)
+    {
+        return _stk_alloc(bytes);
+    }
+
+    static void operator delete(void* p)
+    {
+        _stk_free(p);
+    }
+};
+
+_stk_type_int _stk_list_grow_capacity(_stk_type_int size)
+{
+    return size < 4 ? 8 : size * 2;
+}
+
+/*
+ * Appending lists no larger than this copies them right away; allocating a
+ * pending concatenation costs more than copying a handful of members.
+ */
+_stk_type_int const _stk_list_eager_append_size = 32;
+
+/*
+ * Pending concatenations deeper than this are flattened on creation, which
+ * bounds both the flattening stack and the recursion when a rope is released.
+ */
+int const _stk_list_max_rope_depth = 64;
+
+template <typename _MemberType> struct _stk_list;
+template <typename _MemberType> struct _stk_list_concat;
+
+/*
+ * Lists of int, float or bool keep up to _stk_list_inline_size bytes of
+ * members inside the handle; a list that fits there owns no buffer, and its
+ * members are copied along with the handle instead of being shared.
+ */
+template <typename _MemberType>
+struct _stk_list_inline_count {
+    static int const value = 0;
+};
+
+template <>
+struct _stk_list_inline_count<_stk_type_int> {
+    static int const value = _stk_list_inline_size / sizeof(_stk_type_int);
+};
+
+template <>
+struct _stk_list_inline_count<_stk_type_float> {
+    static int const value = _stk_list_inline_size / sizeof(_stk_type_float);
+};
+
+template <>
+struct _stk_list_inline_count<_stk_type_bool> {
+    static int const value = _stk_list_inline_size / sizeof(_stk_type_bool);
+};
+
+template <typename _MemberType, int _Count>
+struct _stk_list_inline {
+    union {
+        _stk_type_int align;
+        char bytes[_Count * sizeof(_MemberType)];
+    } _inline_space;
+
+    _MemberType* inline_members() const
+    {
+        return reinterpret_cast<_MemberType*>(const_cast<char*>(_inline_space.bytes));
+    }
+};
+
+template <typename _MemberType>
+struct _stk_list_inline<_MemberType, 0> {
+    _MemberType* inline_members() const
+    {
+        return NULL;
+    }
+};
+
+template <typename _MemberType>
+struct _stk_list_buffer
+    : _stk_arena_object
+{
+    int ref_count;
+    _stk_type_int capacity;
+    _stk_type_int used;
+    _MemberType* members;
+    _stk_list_concat<_MemberType>* pending;
+    bool const fixed;
+
+    explicit _stk_list_buffer(_stk_type_int cap)
+        : ref_count(1)
+        , capacity(cap)
+        , used(0)
+        , members(_stk_new_members<_MemberType>(cap))
+        , pending(NULL)
+        , fixed(false)
+    {}
+
+    _stk_list_buffer(_MemberType const* m, _stk_type_int size)
+        : ref_count(1)
+        , capacity(size)
+        , used(size)
+        , members(const_cast<_MemberType*>(m))
+        , pending(NULL)
+        , fixed(true)
+    {}
+
+    _stk_list_buffer(_stk_list<_MemberType> const& lhs, _stk_list<_MemberType> const& rhs);
+
+    ~_stk_list_buffer();
+
+    _MemberType* flatten();
+
+    bool extend(_stk_type_int cap)
+    {
+        if (fixed || !_stk_extend_members(members, capacity, cap)) {
+            return false;
+        }
+        capacity = cap;
+        return true;
+    }
+};
+
+template <typename _MemberType>
+struct _stk_list
+    : _stk_list_inline<_MemberType, _stk_list_inline_count<_MemberType>::value>
+{
+    static int const inline_count = _stk_list_inline_count<_MemberType>::value;
+
+    _stk_type_int _size;
+    mutable _MemberType* _members;
+    _stk_list_buffer<_MemberType>* _buffer;
+
+    explicit _stk_list(int reserved)
+        : _size(0)
+        , _members(NULL)
+        , _buffer(NULL)
+    {
+        if (reserved <= inline_count) {
+            _members = this->inline_members();
+        } else {
+            _buffer = new _stk_list_buffer<_MemberType>(reserved);
+            _members = _buffer->members;
+        }
+    }
+
+    _stk_list()
+        : _size(0)
+        , _members(NULL)
+        , _buffer(NULL)
+    {}
+
+    explicit _stk_list(_stk_list_buffer<_MemberType>& buffer)
+        : _size(buffer.used)
+        , _members(buffer.members)
+        , _buffer(&buffer)
+    {
+        share();
+    }
+
+    _stk_list(_stk_list<_MemberType> const& rhs)
+        : _size(0)
+        , _members(NULL)
+        , _buffer(NULL)
+    {
+        refer(rhs);
+    }
+
+    _stk_list(_stk_list<_MemberType>&& rhs)
+        : _size(0)
+        , _members(NULL)
+        , _buffer(NULL)
+    {
+        take(rhs);
+    }
+
+    _stk_list const& operator=(_stk_list<_MemberType> const& rhs)
+    {
+        if (this != &rhs) {
+            release();
+            refer(rhs);
+        }
+        return *this;
+    }
+
+    _stk_list const& operator=(_stk_list<_MemberType>&& rhs)
+    {
+        if (this != &rhs) {
+            release();
+            take(rhs);
+        }
+        return *this;
+    }
+
+    void refer(_stk_list<_MemberType> const& rhs)
+    {
+        _size = rhs._size;
+        _buffer = rhs._buffer;
+        if (rhs.inlined()) {
+            _members = this->inline_members();
+            _stk_copy_members(rhs._members, rhs._members + rhs._size, _members);
+        } else {
+            _members = rhs._members;
+            share();
+        }
+    }
+
+    /*
+     * Takes over the reference held by rhs, which is left empty; only inline
+     * members have to be copied over.
+     */
+    void take(_stk_list<_MemberType>& rhs)
+    {
+        _size = rhs._size;
+        _buffer = rhs._buffer;
+        if (rhs.inlined()) {
+            _members = this->inline_members();
+            _stk_copy_members(rhs._members, rhs._members + rhs._size, _members);
+        } else {
+            _members = rhs._members;
+        }
+        rhs._size = 0;
+        rhs._members = NULL;
+        rhs._buffer = NULL;
+    }
+
+    bool inlined() const
+    {
+        return NULL == _buffer && NULL != _members;
+    }
+
+    void resize(_stk_type_int size)
+    {
+        _size = size;
+        if (NULL != _buffer) {
+            _buffer->used = size;
+        }
+    }
+
+    void share() const
+    {
+        if (NULL != _buffer) {
+            ++_buffer->ref_count;
+        }
+    }
+
+    void release()
+    {
+        if (NULL != _buffer && 0 == --_buffer->ref_count) {
+            delete _buffer;
+        }
+        _size = 0;
+        _members = NULL;
+        _buffer = NULL;
+    }
+
+    ~_stk_list()
+    {
+        release();
+    }
+
+    static _stk_list concat(_stk_list const& lhs, _stk_list const& rhs)
+    {
+        _stk_list result;
+        result._size = lhs._size + rhs._size;
+        result._buffer = new _stk_list_buffer<_MemberType>(lhs, rhs);
+        return result;
+    }
+
+    bool pending() const
+    {
+        return NULL == _members && NULL != _buffer && NULL != _buffer->pending;
+    }
+
+    int rope_depth() const
+    {
+        return pending() ? _buffer->pending->depth : 0;
+    }
+
+    /*
+     * Members are only laid out contiguously on demand.  The buffer is shared
+     * by every copy of a pending list, so whichever copy flattens it first
+     * does so for all of them.
+     */
+    void flatten() const
+    {
+        if (NULL == _members && NULL != _buffer) {
+            _members = _buffer->flatten();
+        }
+    }
+
+    /*
+     * Copies the members into dst in order without flattening any pending
+     * concatenation on the way: leaves are visited left to right with an
+     * explicit stack and each one is copied as a single contiguous run.
+     */
+    _MemberType* copy_to(_MemberType* dst) const
+    {
+        _stk_list const* pieces[_stk_list_max_rope_depth + 2];
+        int top = 0;
+        pieces[top++] = this;
+        while (0 != top) {
+            _stk_list const* piece = pieces[--top];
+            if (piece->pending()) {
+                pieces[top++] = &piece->_buffer->pending->rhs;
+                pieces[top++] = &piece->_buffer->pending->lhs;
+            } else {
+                piece->flatten();
+                dst = _stk_copy_members(piece->_members, piece->_members + piece->_size, dst);
+            }
+        }
+        return dst;
+    }
+
+    _stk_type_bool empty() const
+    {
+        return _size == 0;
+    }
+
+    _stk_type_int size() const
+    {
+        return _size;
+    }
+
+    _MemberType first() const
+    {
+        if (pending()) {
+            return _buffer->pending->lhs.first();
+        }
+        flatten();
+        return _members[0];
+    }
+
+    /*
+     * Versions sharing a buffer only ever read their own prefix of it, so the
+     * version ending at the last used slot may append into the spare capacity
+     * without disturbing the others.  Lacking room, the buffer is grown where
+     * it is if its block can be extended.
+     */
+    bool tail_appendable(_stk_type_int count) const
+    {
+        if (NULL == _buffer || pending()) {
+            return false;
+        }
+        flatten();
+        _stk_type_int end = _members + _size - _buffer->members;
+        if (end < _buffer->used) {
+            return false;
+        }
+        _buffer->used = end;
+        return end + count <= _buffer->capacity
+            || _buffer->extend(_stk_list_grow_capacity(end + count));
+    }
+
+    _stk_list push_back(_MemberType const& value) const
+    {
+        if (pending()) {
+            _stk_list_concat<_MemberType> const& c = *_buffer->pending;
+            return concat(c.lhs, c.rhs.push_back(value));
+        }
+        if (tail_appendable(1)) {
+            _buffer->members[_buffer->used++] = value;
+            _stk_list result(*this);
+            ++result._size;
+            return result;
+        }
+        _stk_type_int size = _size + 1;
+        _stk_list result(size <= inline_count ? size : _stk_list_grow_capacity(size));
+        _stk_copy_members(_members, _members + _size, result._members);
+        result._members[_size] = value;
+        result.resize(size);
+        return result;
+    }
+};
+
+template <typename _MemberType>
+struct _stk_list_concat
+    : _stk_arena_object
+{
+    _stk_list<_MemberType> const lhs;
+    _stk_list<_MemberType> const rhs;
+    int const depth;
+
+    _stk_list_concat(_stk_list<_MemberType> const& l, _stk_list<_MemberType> const& r)
+        : lhs(l)
+        , rhs(r)
+        , depth(1 + std::max(l.rope_depth(), r.rope_depth()))
+    {}
+};
+
+template <typename _MemberType>
+_stk_list_buffer<_MemberType>::_stk_list_buffer(_stk_list<_MemberType> const& lhs
+                                              , _stk_list<_MemberType> const& rhs)
+    : ref_count(1)
+    , capacity(lhs._size + rhs._size)
+    , used(0)
+    , members(NULL)
+    , pending(new _stk_list_concat<_MemberType>(lhs, rhs))
+    , fixed(false)
+{}
+
+template <typename _MemberType>
+_stk_list_buffer<_MemberType>::~_stk_list_buffer()
+{
+    _stk_delete_members(members, capacity);
+    delete pending;
+}
+
+template <typename _MemberType>
+_MemberType* _stk_list_buffer<_MemberType>::flatten()
+{
+    if (NULL != pending) {
+        members = _stk_new_members<_MemberType>(capacity);
+        pending->rhs.copy_to(pending->lhs.copy_to(members));
+        used = capacity;
+        delete pending;
+        pending = NULL;
+    }
+    return members;
+}
+
+/*
+ * Members of a list literal made of literals only are a static constant
+ * array.  The buffer keeps a reference of its own, so the lists viewing it
+ * never free it, and as it is always full none of them appends into it.
+ */
+template <typename _MemberType>
+struct _stk_static_list_buffer
+    : _stk_list_buffer<_MemberType>
+{
+    _stk_static_list_buffer(_MemberType const* m, _stk_type_int size)
+        : _stk_list_buffer<_MemberType>(m, size)
+    {}
+
+    ~_stk_static_list_buffer()
+    {
+        this->members = NULL;
+    }
+
+    _stk_list<_MemberType> list()
+    {
+        return _stk_list<_MemberType>(*this);
+    }
+};
+
+template <int _Size, typename _MemberType>
+struct _stk_list_builder {
+    mutable _stk_list<_MemberType> list;
+    mutable _stk_type_int cursor;
+
+    _stk_list_builder()
+        : list(_Size)
+        , cursor(0)
+    {
+        list.resize(_Size);
+    }
+
+    _stk_list_builder const& push(_MemberType const& m) const
+    {
+        list._members[cursor++] = m;
+        return *this;
+    }
+
+    _stk_list<_MemberType> build() const
+    {
+        return std::move(list);
+    }
+};
+
+struct _stk_empty_list_type {
+    template <typename _MemberType>
+    operator _stk_list<_MemberType>()
+    {
+        return _stk_list<_MemberType>();
+    }
+
+    _stk_type_bool empty() const
+    {
+        return true;
+    }
+
+    _stk_type_int size() const
+    {
+        return 0;
+    }
+
+    template <typename _MemberType>
+    _stk_list<_MemberType> push_back(_MemberType const& value) const
+    {
+        _stk_list<_MemberType> result(_stk_list_grow_capacity(1));
+        result._members[0] = value;
+        result.resize(1);
+        return result;
+    }
+};
+
+template <typename _T>
+_stk_list<_T> _stk_list_append(_stk_list<_T> const& lhs, _stk_list<_T> const& rhs)
+{
+    if (lhs.empty()) {
+        return rhs;
+    }
+    if (rhs.empty()) {
+        return lhs;
+    }
+
+    if (lhs.tail_appendable(rhs._size)) {
+        rhs.copy_to(lhs._buffer->members + lhs._buffer->used);
+        lhs._buffer->used += rhs._size;
+        _stk_list<_T> result(lhs);
+        result._size += rhs._size;
+        return result;
+    }
+
+    _stk_type_int size = lhs._size + rhs._size;
+    if (size <= _stk_list_eager_append_size) {
+        _stk_list<_T> result(size);
+        rhs.copy_to(lhs.copy_to(result._members));
+        result.resize(size);
+        return result;
+    }
+    if (std::max(lhs.rope_depth(), rhs.rope_depth()) >= _stk_list_max_rope_depth) {
+        _stk_list<_T> result(_stk_list_grow_capacity(size));
+        rhs.copy_to(lhs.copy_to(result._members));
+        result.resize(size);
+        return result;
+    }
+    return _stk_list<_T>::concat(lhs, rhs);
+}
+
+template <typename _T>
+_stk_list<_T> _stk_list_append(_stk_empty_list_type lhs, _stk_list<_T> const& rhs)
+{
+    return rhs;
+}
+
+template <typename _T>
+_stk_list<_T> _stk_list_append(_stk_list<_T> const& lhs, _stk_empty_list_type rhs)
+{
+    return lhs;
+}
+
+_stk_empty_list_type _stk_list_append(_stk_empty_list_type lhs, _stk_empty_list_type rhs)
+{
+    return _stk_empty_list_type();
+}
+
+/*
+ * Narrows [begin, end) of the source list by index comparisons, all taken
+ * against the source indices; the resulting slice shares the source buffer.
+ */
+template <typename _MemberType>
+struct _stk_list_slicer {
+    _stk_list<_MemberType> const list;
+    _stk_type_int begin;
+    _stk_type_int end;
+
+    explicit _stk_list_slicer(_stk_list<_MemberType> const& l)
+        : list(l)
+        , begin(0)
+        , end(l._size)
+    {}
+
+    _stk_list_slicer& ge(_stk_type_int n)
+    {
+        if (n > begin) {
+            begin = std::min(n, end);
+        }
+        return *this;
+    }
+
+    _stk_list_slicer& gt(_stk_type_int n)
+    {
+        if (n >= begin) {
+            begin = n < end ? n + 1 : end;
+        }
+        return *this;
+    }
+
+    _stk_list_slicer& lt(_stk_type_int n)
+    {
+        if (n < end) {
+            end = std::max(n, begin);
+        }
+        return *this;
+    }
+
+    _stk_list_slicer& le(_stk_type_int n)
+    {
+        if (n < end) {
+            end = std::max(n + 1, begin);
+        }
+        return *this;
+    }
+
+    _stk_list_slicer& eq(_stk_type_int n)
+    {
+        return ge(n).le(n);
+    }
+
+    _stk_list<_MemberType> slice() const
+    {
+        if (begin == end) {
+            return _stk_list<_MemberType>();
+        }
+        list.flatten();
+        _stk_list<_MemberType> result(list);
+        result._members += begin;
+        result._size = end - begin;
+        return result;
+    }
 };
 
 template <typename _MemberType>
-struct _stk_list
-    : _stk_res_entry
+_stk_list_slicer<_MemberType> _stk_list_range(_stk_list<_MemberType> const& list)
 {
-    _stk_type_int _size;
-    _MemberType* _members;
+    return _stk_list_slicer<_MemberType>(list);
+}
 
-    explicit _stk_list(int reserved)
-        : _size(0)
-        , _members(new _MemberType[reserved])
-    {}
+struct _stk_empty_list_slicer {
+    _stk_empty_list_slicer& ge(_stk_type_int) { return *this; }
+    _stk_empty_list_slicer& gt(_stk_type_int) { return *this; }
+    _stk_empty_list_slicer& lt(_stk_type_int) { return *this; }
+    _stk_empty_list_slicer& le(_stk_type_int) { return *this; }
+    _stk_empty_list_slicer& eq(_stk_type_int) { return *this; }
 
-    _stk_list()
-        : _size(0)
-        , _members(NULL)
-    {}
+    _stk_empty_list_type slice() const
+    {
+        return _stk_empty_list_type();
+    }
+};
 
-    _stk_list(_stk_list<_MemberType> const& rhs)
-        : _size(0)
-        , _members(NULL)
+_stk_empty_list_slicer _stk_list_range(_stk_empty_list_type)
+{
+    return _stk_empty_list_slicer();
+}
+
+/*
+ * Kernels for numeric map pipes work on GCC vector types: 32 bytes are one
+ * AVX2 register, or a pair of SSE registers when AVX2 is not enabled.
+ * Vectors are passed by reference only, which keeps the ABI independent of
+ * the target flags.
+ */
+template <typename _T>
+struct _stk_simd {
+    typedef _T vector __attribute__((vector_size(32)));
+    static int const width = 32 / sizeof(_T);
+
+    static void load(vector& v, _T const* src)
     {
-        copy_members(rhs);
+        __builtin_memcpy(&v, src, sizeof v);
     }
 
-    _stk_list const& operator=(_stk_list<_MemberType> const& rhs)
+    static void store(_T* dst, vector const& v)
     {
-        copy_members(rhs);
+        __builtin_memcpy(dst, &v, sizeof v);
     }
 
-    void init(void* dst_mem)
+    static void splat(vector& v, _T x)
     {
-        new(dst_mem)_stk_list(*this);
+        _T lanes[width];
+        std::fill(lanes, lanes + width, x);
+        load(v, lanes);
     }
 
-    void copy_members(_stk_list<_MemberType> const& rhs)
+    static void iota(vector& v, _T first)
     {
-        _stk_list copy;
-        copy._size = rhs._size;
-        copy._members = new _MemberType[copy._size];
-        for (_stk_type_int i = 0; i < rhs._size; ++i) {
-            copy._members[i] = rhs._members[i];
+        _T lanes[width];
+        for (int i = 0; i < width; ++i) {
+            lanes[i] = first + i;
         }
+        load(v, lanes);
+    }
+};
 
-        delete[] _members;
-        _size = copy._size;
-        _members = copy._members;
+/*
+ * Pipes over long lists are cut into chunks, which are run by a small
+ * work-stealing pool: each worker takes chunks from its own queue first and
+ * steals from the others when it runs out.  The caller works as worker 0.
+ * STKN_THREADS sets the number of workers, the hardware concurrency by
+ * default; with 1 worker every pipe runs on the calling thread.
+ */
+_stk_type_int const _stk_pipe_chunk_size = 16384;
+_stk_type_int const _stk_parallel_pipe_min_size = _stk_pipe_chunk_size * 4;
+
+struct _stk_chunk_job {
+    virtual ~_stk_chunk_job() {}
+    virtual void run(_stk_type_int chunk) = 0;
+};
 
-        copy._size = 0;
-        copy._members = NULL;
-    }
+struct _stk_chunk_queue {
+    std::mutex lock;
+    std::deque<_stk_type_int> chunks;
 
-    ~_stk_list()
+    bool pop(_stk_type_int& chunk)
     {
-        delete[] _members;
+        std::lock_guard<std::mutex> guard(lock);
+        if (chunks.empty()) {
+            return false;
+        }
+        chunk = chunks.front();
+        chunks.pop_front();
+        return true;
     }
 
-    _stk_type_bool empty() const
+    bool steal(_stk_type_int& chunk)
     {
-        return _size == 0;
+        std::lock_guard<std::mutex> guard(lock);
+        if (chunks.empty()) {
+            return false;
+        }
+        chunk = chunks.back();
+        chunks.pop_back();
+        return true;
     }
+};
 
-    _stk_type_int size() const
+struct _stk_thread_pool {
+    int const size;
+    _stk_chunk_queue* const queues;
+    std::vector<std::thread> workers;
+
+    std::mutex lock;
+    std::condition_variable wake;
+    unsigned long generation;
+    bool stopping;
+    std::atomic<_stk_chunk_job*> job;
+    std::atomic<_stk_type_int> remaining;
+
+    explicit _stk_thread_pool(int s)
+        : size(s)
+        , queues(new _stk_chunk_queue[s])
+        , generation(0)
+        , stopping(false)
+        , job(NULL)
+        , remaining(0)
     {
-        return _size;
+        for (int i = 1; i < size; ++i) {
+            workers.push_back(std::thread(&_stk_thread_pool::loop, this, i));
+        }
     }
 
-    _MemberType first() const
+    ~_stk_thread_pool()
     {
-        return _members[0];
+        {
+            std::lock_guard<std::mutex> guard(lock);
+            stopping = true;
+        }
+        wake.notify_all();
+        for (unsigned i = 0; i < workers.size(); ++i) {
+            workers[i].join();
+        }
+        delete[] queues;
     }
 
-    _stk_list push_back(_MemberType const& value) const
+    static int threadCount()
     {
-        _stk_list result;
-        result._size = _size + 1;
-        result._members = new _MemberType[result._size];
-        for (_stk_type_int i = 0; i < _size; ++i) {
-            result._members[i] = _members[i];
-        }
-        result._members[_size] = value;
-        return result;
+        char const* env = std::getenv("STKN_THREADS");
+        int count = NULL == env ? int(std::thread::hardware_concurrency()) : std::atoi(env);
+        return count < 1 ? 1 : count;
     }
-};
-
-template <int _Size, typename _MemberType>
-struct _stk_list_builder {
-    mutable _stk_list<_MemberType> list;
-    mutable _stk_type_int cursor;
 
-    _stk_list_builder()
-        : cursor(0)
+    static _stk_thread_pool& get()
     {
-        list._size = _Size;
-        list._members = new _MemberType[_Size];
+        static _stk_thread_pool pool(threadCount());
+        return pool;
     }
 
-    _stk_list_builder const& push(_MemberType const& m) const
+    void run(_stk_chunk_job& j, _stk_type_int chunk_count)
     {
-        list._members[cursor++] = m;
-        return *this;
+        job = &j;
+        remaining = chunk_count;
+        for (_stk_type_int c = 0; c < chunk_count; ++c) {
+            _stk_chunk_queue& queue = queues[c * size / chunk_count];
+            std::lock_guard<std::mutex> guard(queue.lock);
+            queue.chunks.push_back(c);
+        }
+        {
+            std::lock_guard<std::mutex> guard(lock);
+            ++generation;
+        }
+        wake.notify_all();
+        work(0);
+        while (0 != remaining) {
+            std::this_thread::yield();
+        }
     }
 
-    _stk_list<_MemberType> build() const
+    void work(int self)
     {
-        return list;
+        _stk_type_int chunk;
+        while (queues[self].pop(chunk) || steal(self, chunk)) {
+            job.load()->run(chunk);
+            --remaining;
+        }
     }
-};
 
-struct _stk_empty_list_type {
-    template <typename _MemberType>
-    operator _stk_list<_MemberType>()
+    bool steal(int self, _stk_type_int& chunk)
     {
-        return _stk_list<_MemberType>();
+        for (int i = 1; i < size; ++i) {
+            if (queues[(self + i) % size].steal(chunk)) {
+                return true;
+            }
+        }
+        return false;
     }
 
-    _stk_type_bool empty() const
+    void loop(int self)
     {
-        return true;
+        unsigned long seen = 0;
+        while (true) {
+            {
+                std::unique_lock<std::mutex> guard(lock);
+                wake.wait(guard, [&]() { return stopping || seen != generation; });
+                if (stopping) {
+                    return;
+                }
+                seen = generation;
+            }
+            work(self);
+        }
     }
+};
 
-    _stk_type_int size() const
+template <typename _Pipe, typename _SrcType, typename _DstType>
+struct _stk_pipe_chunks
+    : _stk_chunk_job
+{
+    _Pipe& pipe;
+    _stk_list<_SrcType> const& src;
+    _DstType* const dst;
+    _stk_type_int* const counts;
+
+    _stk_pipe_chunks(_Pipe& p, _stk_list<_SrcType> const& s, _DstType* d, _stk_type_int* c)
+        : pipe(p)
+        , src(s)
+        , dst(d)
+        , counts(c)
+    {}
+
+    void run(_stk_type_int chunk)
     {
-        return 0;
+        _stk_type_int begin = chunk * _stk_pipe_chunk_size;
+        _stk_type_int end = std::min(begin + _stk_pipe_chunk_size, src._size);
+        counts[chunk] = pipe._stk_chunk(src, begin, end, dst + begin);
     }
+};
 
-    template <typename _MemberType>
-    _stk_list<_MemberType> push_back(_MemberType const& value) const
+template <typename _DstType>
+struct _stk_compact_chunks
+    : _stk_chunk_job
+{
+    _DstType const* const staged;
+    _DstType* const dst;
+    _stk_type_int const* const counts;
+    _stk_type_int const* const offsets;
+
+    _stk_compact_chunks(_DstType const* s
+                      , _DstType* d
+                      , _stk_type_int const* c
+                      , _stk_type_int const* o)
+        : staged(s)
+        , dst(d)
+        , counts(c)
+        , offsets(o)
+    {}
+
+    void run(_stk_type_int chunk)
     {
-        _stk_list<_MemberType> result;
-        result._size = 1;
-        result._members = new _MemberType[1];
-        result._members[0] = value;
-        return result;
+        _DstType const* begin = staged + chunk * _stk_pipe_chunk_size;
+        _stk_copy_members(begin, begin + counts[chunk], dst + offsets[chunk]);
     }
 };
 
-template <typename _T>
-_stk_list<_T> _stk_list_append(_stk_list<_T> const& lhs, _stk_list<_T> const& rhs)
+/*
+ * A pipe run by chunks has a _stk_chunk member that handles the source range
+ * [begin, end) and returns how many members it wrote.  In parallel, every
+ * chunk writes at the position of its source range; if some chunk wrote less
+ * (the pipe filters), a prefix sum over the chunk counts gives each chunk its
+ * place in a compact result, and the chunks are copied there in parallel.
+ */
+template <typename _DstType, bool _Parallel, typename _Pipe, typename _SrcType>
+_stk_list<_DstType> _stk_run_pipe(_Pipe& pipe, _stk_list<_SrcType> const& src)
 {
-    _stk_list<_T> result;
-    result._size = lhs._size + rhs._size;
-    result._members = new _T[result._size];
+    src.flatten();
+    _stk_list<_DstType> result(src._size);
+    if (!_Parallel
+            || src._size < _stk_parallel_pipe_min_size
+            || 1 == _stk_thread_pool::get().size)
+    {
+        result.resize(pipe._stk_chunk(src, 0, src._size, result._members));
+        return result;
+    }
 
-    for (_stk_type_int i = 0; i < lhs._size; ++i) {
-        result._members[i] = lhs._members[i];
+    _stk_thread_pool& pool = _stk_thread_pool::get();
+    _stk_type_int chunk_count = (src._size + _stk_pipe_chunk_size - 1) / _stk_pipe_chunk_size;
+    std::vector<_stk_type_int> counts(chunk_count);
+    _stk_pipe_chunks<_Pipe, _SrcType, _DstType> chunks(pipe, src, result._members, counts.data());
+    pool.run(chunks, chunk_count);
+
+    std::vector<_stk_type_int> offsets(chunk_count);
+    _stk_type_int result_size = 0;
+    for (_stk_type_int c = 0; c < chunk_count; ++c) {
+        offsets[c] = result_size;
+        result_size += counts[c];
     }
-    for (_stk_type_int i = 0; i < rhs._size ; ++i) {
-        result._members[lhs._size + i] = rhs._members[i];
+    if (result_size == src._size) {
+        result.resize(result_size);
+        return result;
     }
 
-    return result;
+    _stk_list<_DstType> compact(result_size);
+    _stk_compact_chunks<_DstType> compact_chunks(
+            result._members, compact._members, counts.data(), offsets.data());
+    pool.run(compact_chunks, chunk_count);
+    compact.resize(result_size);
+    return compact;
 }
 
 template <typename _T>
-_stk_list<_T> _stk_list_append(_stk_empty_list_type lhs, _stk_list<_T> const& rhs)
+void push(void* mem, int offset, _T const& value)
 {
-    return rhs;
+    *(_T*)(offset + (_stk_type_1_byte*)(mem)) = value;
 }
 
-template <typename _T>
-_stk_list<_T> _stk_list_append(_stk_list<_T> const& lhs, _stk_empty_list_type rhs)
+template <typename _MemberType>
+void push(void* mem, int offset, _stk_list<_MemberType> const& list)
 {
-    return lhs;
+    new(offset + (_stk_type_1_byte*)(mem))_stk_list<_MemberType>(list);
 }
 
-_stk_empty_list_type _stk_list_append(_stk_empty_list_type lhs, _stk_empty_list_type rhs)
+template <typename _MemberType>
+void push(void* mem, int offset, _stk_list<_MemberType>&& list)
 {
-    return _stk_empty_list_type();
+    new(offset + (_stk_type_1_byte*)(mem))_stk_list<_MemberType>(std::move(list));
 }
 
+/*
+ * Resource slots of a frame are known when the program is compiled: each
+ * holds an empty value from the frame construction on, so the frame can
+ * destroy all of them without recording which ones have been initialized.
+ */
 template <typename _T>
-void push(void* mem, int offset, _T const& value)
+void _stk_res_init(void* mem, int offset)
 {
-    *(_T*)(offset + (_stk_type_1_byte*)(mem)) = value;
+    new(offset + (_stk_type_1_byte*)(mem))_T();
 }
 
-template <typename _MemberType>
-void push(void* mem, int offset, _stk_list<_MemberType> const& list)
+template <typename _T>
+void _stk_res_destroy(void* mem, int offset)
 {
-    new(offset + (_stk_type_1_byte*)(mem))_stk_list<_MemberType>(list);
+    reinterpret_cast<_T*>(offset + (_stk_type_1_byte*)(mem))->~_T();
 }
 
 template <int _Size>
-struct _stk_res_entries {
-    int entries[_Size];
-    int cursor;
+struct _stk_composite {
+    _stk_type_1_byte mem[_Size];
 
-    _stk_res_entries()
-        : cursor(0)
-    {}
+    _stk_composite() {}
 
-    _stk_res_entries(_stk_res_entries const& rhs)
-        : cursor(rhs.cursor)
+    _stk_composite(_stk_composite const& rhs)
     {
-        for (int i = 0; i < cursor; ++i) {
-            entries[i] = rhs.entries[i];
-        }
+        operator=(rhs);
     }
 
-    void add(int offset)
+    _stk_composite const& operator=(_stk_composite const& rhs)
     {
-        entries[cursor] = offset;
-        ++cursor;
+        std::copy(rhs.mem, rhs.mem + _Size, mem);
+        return *this;
     }
 
-    void dtor(void* mem)
+    template <typename _T>
+    _stk_composite push(int offset, _T&& value)
     {
-        for (int i = 0; i < cursor; ++i) {
-            ((_stk_res_entry*)(entries[i] + (char*)(mem)))->~_stk_res_entry();
-        }
+        ::push(mem, offset, std::forward<_T>(value));
+        return *this;
     }
+
+    ~_stk_composite() {}
 };
 
 template <>
-struct _stk_res_entries<0> {
-    _stk_res_entries() {}
-    _stk_res_entries(_stk_res_entries const&) {}
-    void dtor(void*) {}
+struct _stk_composite<0> {
+    _stk_composite() {}
+    _stk_composite(_stk_composite const&) {}
+
+    _stk_composite const& operator=(_stk_composite const&)
+    {
+        return *this;
+    }
 };
 
-template <int _Size>
-struct _stk_entries_builder {
-    mutable _stk_res_entries<_Size> res_entries;
-    mutable int cursor;
+/*
+ * Text of write statements is gathered here and handed to stdout in large
+ * blocks, when the buffer fills up and when the program exits.
+ */
+struct _stk_output {
+    static int const capacity = 1 << 16;
+    static int const max_value_length = 32;
 
-    _stk_entries_builder()
-        : cursor(0)
+    _stk_output()
+        : used(0)
     {}
 
-    _stk_entries_builder const& push(int entry) const
+    ~_stk_output()
     {
-        res_entries.set(cursor++, entry);
-        return *this;
+        flush();
     }
 
-    _stk_res_entries<_Size> build() const
+    void flush()
     {
-        return res_entries;
+        fwrite(buffer, 1, used, stdout);
+        used = 0;
     }
-};
 
-template <int _Size>
-struct _stk_composite {
-    _stk_type_1_byte mem[_Size];
+    char* reserve(int length)
+    {
+        if (capacity - used < length) {
+            flush();
+        }
+        return buffer + used;
+    }
 
-    _stk_composite() {}
+    char const* limit() const
+    {
+        return buffer + capacity - max_value_length;
+    }
 
-    _stk_composite(_stk_composite const& rhs)
+    void commit(char* end)
     {
-        operator=(rhs);
+        used = end - buffer;
     }
 
-    _stk_composite const& operator=(_stk_composite const& rhs)
+    void put(char c)
     {
-        std::copy(rhs.mem, rhs.mem + _Size, mem);
-        return *this;
+        *reserve(1) = c;
+        ++used;
     }
 
-    template <typename _T>
-    _stk_composite push(int offset, _T const& value)
+    void put(char const* text, int length)
     {
-        ::push(mem, offset, value);
-        return *this;
+        std::memcpy(reserve(length), text, length);
+        used += length;
     }
 
-    ~_stk_composite() {}
+    char buffer[capacity];
+    int used;
 };
 
-template <>
-struct _stk_composite<0> {
-    _stk_composite() {}
-    _stk_composite(_stk_composite const&) {}
+_stk_output _stk_out;
 
-    _stk_composite const& operator=(_stk_composite const&)
-    {
-        return *this;
+char const _stk_digit_pairs[] =
+    "0001020304050607080910111213141516171819"
+    "2021222324252627282930313233343536373839"
+    "4041424344454647484950515253545556575859"
+    "6061626364656667686970717273747576777879"
+    "8081828384858687888990919293949596979899";
+
+char* _stk_format_int(_stk_type_int value, char* dst)
+{
+    unsigned long long rest = value;
+    if (value < 0) {
+        *dst++ = '-';
+        rest = 0ULL - rest;
     }
-};
+    char digits[24];
+    char* begin = digits + sizeof digits;
+    for (; rest >= 100; rest /= 100) {
+        begin -= 2;
+        std::memcpy(begin, _stk_digit_pairs + rest % 100 * 2, 2);
+    }
+    if (rest >= 10) {
+        begin -= 2;
+        std::memcpy(begin, _stk_digit_pairs + rest * 2, 2);
+    } else {
+        *--begin = '0' + rest;
+    }
+    int length = digits + sizeof digits - begin;
+    std::memcpy(dst, begin, length);
+    return dst + length;
+}
 
-std::ostream& operator<<(std::ostream& os, _stk_type_bool const& b)
+/*
+ * Same text as std::ostream gives with its default precision, that is "%g":
+ * integral values in the range where it prints every digit take the integer
+ * path, the others go through snprintf.
+ */
+char* _stk_format_float(_stk_type_float value, char* dst)
 {
-    return os << (0 == b.boolean ? "false" : "true");
+    if (-1e6 < value && value < 1e6) {
+        _stk_type_int integral(value);
+        if (_stk_type_float(integral) == value && !(0 == integral && std::signbit(value))) {
+            return _stk_format_int(integral, dst);
+        }
+    }
+    return dst + snprintf(dst, _stk_output::max_value_length, "%g", double(value));
 }
 
-std::ostream& operator<<(std::ostream& os, _stk_type_void)
+void _stk_write_value(_stk_output& out, _stk_type_int i)
 {
-    return os;
+    out.commit(_stk_format_int(i, out.reserve(_stk_output::max_value_length)));
 }
 
-template <typename _MemberType>
-std::ostream& operator<<(std::ostream& os, _stk_list<_MemberType> const& list)
+void _stk_write_value(_stk_output& out, _stk_type_float f)
+{
+    out.commit(_stk_format_float(f, out.reserve(_stk_output::max_value_length)));
+}
+
+void _stk_write_value(_stk_output& out, _stk_type_bool const& b)
 {
-    os << "[ ";
-    for (_stk_type_int i = 0; i < list._size; ++i) {
-        os << list._members[i] << ' ';
+    if (0 == b.boolean) {
+        out.put("false", 5);
+    } else {
+        out.put("true", 4);
     }
-    return os << ']';
 }
 
-std::ostream& operator<<(std::ostream& os, _stk_empty_list_type)
+void _stk_write_value(_stk_output&, _stk_type_void) {}
+
+void _stk_write_value(_stk_output& out, _stk_empty_list_type)
 {
-    return os << "[ ]";
+    out.put("[ ]", 3);
 }
 
 template <int _Size>
-std::ostream& operator<<(std::ostream& os, _stk_composite<_Size> const& composite)
+void _stk_write_value(_stk_output& out, _stk_composite<_Size> const&)
 {
-    return os << "Stekin Composite (" << _Size << ')';
+    out.put("Stekin Composite (", 18);
+    _stk_write_value(out, _stk_type_int(_Size));
+    out.put(')');
 }
 
-template <int _Level>
-struct _stk_frame_bases {
-    template <int _ExtLevel>
-    _stk_frame_bases(_stk_frame_bases<_ExtLevel> const& ext_bases, void* this_base)
-    {
-        std::copy(ext_bases._stk_ext_bases, ext_bases._stk_ext_bases + _Level, _stk_ext_bases);
-        _stk_ext_bases[_Level] = this_base;
+template <typename _MemberType>
+void _stk_write_members(_stk_output& out, _MemberType const* begin, _MemberType const* end)
+{
+    for (; begin != end; ++begin) {
+        _stk_write_value(out, *begin);
+        out.put(' ');
+    }
+}
+
+/*
+ * Numbers are formatted straight into the buffer, checking for room only
+ * once per member.
+ */
+template <typename _Number, typename _Format>
+void _stk_write_numbers(_stk_output& out, _Number const* begin, _Number const* end
+                      , _Format format)
+{
+    while (begin != end) {
+        char* dst = out.reserve(_stk_output::max_value_length);
+        for (; begin != end && dst <= out.limit(); ++begin) {
+            dst = format(*begin, dst);
+            *dst++ = ' ';
+        }
+        out.commit(dst);
     }
+}
+
+void _stk_write_members(_stk_output& out, _stk_type_int const* begin, _stk_type_int const* end)
+{
+    _stk_write_numbers(out, begin, end, _stk_format_int);
+}
+
+void _stk_write_members(_stk_output& out
+                      , _stk_type_float const* begin
+                      , _stk_type_float const* end)
+{
+    _stk_write_numbers(out, begin, end, _stk_format_float);
+}
+
+template <typename _MemberType>
+void _stk_write_value(_stk_output& out, _stk_list<_MemberType> const& list)
+{
+    list.flatten();
+    out.put("[ ", 2);
+    _stk_write_members(out, list._members, list._members + list._size);
+    out.put(']');
+}
+
+template <typename _T>
+void _stk_write(_T const& value)
+{
+    _stk_write_value(_stk_out, value);
+    _stk_out.put('\n');
+}
+
+template <int _Find, int... _Levels>
+struct _stk_level_index;
+
+template <int _Find>
+struct _stk_level_index<_Find> {
+    static int const value = 0;
+};
+
+template <int _Find, int _Head, int... _Tail>
+struct _stk_level_index<_Find, _Head, _Tail...> {
+    static int const value = _Find == _Head ? 0 : 1 + _stk_level_index<_Find, _Tail...>::value;
+};
+
+/*
+ * Bases of the frames a function reads: those of the outer levels listed in
+ * ascending order, then its own.  Outer levels it never reaches, directly or
+ * through the functions it calls, are not kept.  A level its caller does not
+ * keep either is never read and is left null.
+ */
+template <int _Level, int... _Outer>
+struct _stk_frame_bases {
+    static int const outer_count = sizeof...(_Outer);
+
+    template <typename _ExtBases>
+    _stk_frame_bases(_ExtBases const& ext_bases, void* this_base)
+        : _stk_ext_bases{ ext_bases.template base<_Outer>()..., this_base }
+    {}
 
     _stk_frame_bases(_stk_frame_bases const& cp_bases)
     {
-        std::copy(cp_bases._stk_ext_bases, cp_bases._stk_ext_bases + _Level + 1, _stk_ext_bases);
+        std::copy(cp_bases._stk_ext_bases, cp_bases._stk_ext_bases + outer_count + 1, _stk_ext_bases);
     }
 
     explicit _stk_frame_bases(void* this_base)
     {
-        _stk_ext_bases[_Level] = this_base;
+        _stk_ext_bases[outer_count] = this_base;
+    }
+
+    template <int _BaseLevel>
+    void* base() const
+    {
+        int const index = _stk_level_index<_BaseLevel, _Outer..., _Level>::value;
+        return index > outer_count ? NULL : _stk_ext_bases[std::min(index, outer_count)];
     }
 
     template <typename _T>
-    void push(int offset, _T const& value)
+    void push(int offset, _T&& value)
     {
-        ::push(_stk_ext_bases[_Level], offset, value);
+        ::push(this_base(), offset, std::forward<_T>(value));
     }
 
     void push(int, _stk_type_void) {}
 
     void* this_base() const
     {
-        return _stk_ext_bases[_Level];
+        return _stk_ext_bases[outer_count];
+    }
+
+    void* _stk_ext_bases[outer_count + 1];
+};
+
+/*
+ * Stands for the frame bases in calls to plain functions, which reach no frame
+ * but their own and keep it as a local.
+ */
+struct _stk_plain_bases {};
+
+
+/*
+ * Results of a pure function, keyed by the bits of its scalar arguments.  Each
+ * key hashes to one of a fixed number of entries, and a new result evicts
+ * whatever that entry held.  Entries are allocated on the first call.
+ */
+int const _stk_memo_size_bits = 12;
+
+unsigned long long _stk_memo_bits(_stk_type_int i)
+{
+    return i;
+}
+
+unsigned long long _stk_memo_bits(_stk_type_float f)
+{
+    unsigned long long bits = 0;
+    std::memcpy(&bits, &f, sizeof f);
+    return bits;
+}
+
+unsigned long long _stk_memo_bits(_stk_type_bool b)
+{
+    return b.boolean;
+}
+
+template <typename _Result, typename... _Params>
+struct _stk_memo_table {
+    static int const arity = sizeof...(_Params);
+
+    struct entry {
+        bool used;
+        unsigned long long key[arity];
+        _Result result;
+    };
+
+    explicit _stk_memo_table(char const* n)
+        : name(n)
+        , entries(nullptr)
+        , calls(0)
+        , hits(0)
+    {}
+
+    ~_stk_memo_table()
+    {
+#ifdef STKN_MEMO_STATS
+        std::cerr << name << " memo hits: " << hits << " / " << calls << std::endl;
+#endif
+        delete[] entries;
+    }
+
+    entry& find(unsigned long long const* key)
+    {
+        if (nullptr == entries) {
+            entries = new entry[1 << _stk_memo_size_bits]();
+        }
+        unsigned long long hash = 0;
+        for (int i = 0; i < arity; ++i) {
+            hash = (hash ^ key[i]) * 0x9e3779b97f4a7c15ULL;
+        }
+        return entries[hash >> (64 - _stk_memo_size_bits)];
     }
 
-    void* _stk_ext_bases[_Level + 1];
+    char const* const name;
+    entry* entries;
+    unsigned long calls;
+    unsigned long hits;
 };
 
+template <typename _Result, typename... _Params, typename _Compute>
+_Result _stk_memo_lookup(_stk_memo_table<_Result, _Params...>& table
+                       , unsigned long long const* key
+                       , _Compute compute)
+{
+    int const arity = _stk_memo_table<_Result, _Params...>::arity;
+    typename _stk_memo_table<_Result, _Params...>::entry& cached = table.find(key);
+    ++table.calls;
+    if (cached.used && std::equal(key, key + arity, cached.key)) {
+        ++table.hits;
+        return cached.result;
+    }
+    _Result result(compute());
+    cached.used = true;
+    std::copy(key, key + arity, cached.key);
+    cached.result = result;
+    return result;
+}
+
+template <typename _Func, typename _Result, typename... _Params, int _ExtLevel, int... _ExtOuter
+        , typename... _Args>
+_Result _stk_memo_call(_stk_memo_table<_Result, _Params...>& table
+                     , _stk_frame_bases<_ExtLevel, _ExtOuter...> const& ext_bases
+                     , _Args const&... args)
+{
+    unsigned long long const key[] = { _stk_memo_bits(_Params(args))... };
+    return _stk_memo_lookup(table
+                          , key
+                          , [&]()
+                            {
+                                return _Func(ext_bases, _Params(args)...)._stk_perform();
+                            });
+}
+
+template <typename _Result, typename... _Params, typename... _Args>
+_Result _stk_memo_call(_stk_memo_table<_Result, _Params...>& table
+                     , _Result (*func)(_stk_plain_bases, _Params...)
+                     , _stk_plain_bases bases
+                     , _Args const&... args)
+{
+    unsigned long long const key[] = { _stk_memo_bits(_Params(args))... };
+    return _stk_memo_lookup(table
+                          , key
+                          , [&]()
+                            {
+                                return func(bases, _Params(args)...);
+                            });
+}
@@ -1,51 +1,50 @@
-#include <iostream>
+#include <misc/options.h>
 
 #include "stmt-writer.h"
+#include "emitter.h"
 #include "name-mangler.h"
 
 void output::kwReturn()
 {
-    std::cout << "return ";
+    emitter() << "return ";
+    if (misc::options::get().frame_arena) {
+        emitter() << "_stk_arena_scope(NULL), ";
+    }
 }
 
 void output::returnNothing()
 {
     kwReturn();
-    std::cout << formType("void") << "()";
+    emitter() << formType("void") << "()";
     endOfStatement();
 }
 
 void output::initThisLevel(int offset, std::string const& type_exported_name)
 {
-    std::cout << "new(" << offset << " + (char*)(_stk_bases.this_base()))" << type_exported_name;
-}
-
-void output::addResEntry(int entry_offset)
-{
-    std::cout << "_res_entries.add(" << entry_offset << ");";
+    emitter() << "new(" << offset << " + (char*)(_stk_bases.this_base()))" << type_exported_name;
 }
 
 void output::branchIf()
 {
-    std::cout << "if ";
+    emitter() << "if ";
 }
 
 void output::branchElse()
 {
-    std::cout << " else ";
+    emitter() << " else ";
 }
 
 void output::blockBegin()
 {
-    std::cout << "{" << std::endl;
+    emitter() << "{" << '\n';
 }
 
 void output::blockEnd()
 {
-    std::cout << "}" << std::endl;
+    emitter() << "}" << '\n';
 }
 
 void output::endOfStatement()
 {
-    std::cout << ";" << std::endl;
+    emitter() << ";" << '\n';
 }
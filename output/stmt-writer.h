@@ -9,7 +9,6 @@ namespace output {
     void kwReturn();
     void returnNothing();
     void initThisLevel(int offset, std::string const& type_exported_name);
-    void addResEntry(int entry_offset);
 
     void branchIf();
     void branchElse();
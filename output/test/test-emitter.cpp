@@ -0,0 +1,154 @@
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <climits>
+#include <sstream>
+#include <unistd.h>
+
+#include "../emitter.h"
+
+namespace {
+
+    struct CountingSink
+        : public output::MemorySink
+    {
+        CountingSink()
+            : writes(0)
+        {}
+
+        void write(char const* data, std::size_t size)
+        {
+            ++writes;
+            output::MemorySink::write(data, size);
+        }
+
+        int writes;
+    };
+
+    template <typename _Stream>
+    void writeSample(_Stream& os)
+    {
+        os << std::string("struct") << ' ' << "_stk_frame" << '\n';
+        os << true << false << '\n';
+        os << 0 << ' ' << -7 << ' ' << INT_MAX << ' ' << INT_MIN << '\n';
+        os << 42L << ' ' << LLONG_MAX << ' ' << LLONG_MIN << '\n';
+        os << 0.0 << ' ' << 3.14 << ' ' << -2.5 << ' ' << 0.1 << ' ' << 1e-5 << '\n';
+        os << 100000.0 << ' ' << 1234567.0 << ' ' << 1e20 << ' ' << -1e-300 << '\n';
+    }
+
+}
+
+TEST(Emitter, Formatting)
+{
+    output::MemorySink sink;
+    output::Emitter emitter(util::mkref<output::Sink>(sink));
+    emitter << true << ' ' << false << '\n';
+    emitter << LLONG_MAX << ' ' << LLONG_MIN << ' ' << -1 << '\n';
+    emitter << 3.14 << ' ' << 1e20 << ' ' << 1234567.0 << ' ' << 100000.0 << ' ' << 1e-5 << '\n';
+    emitter.flush();
+
+    ASSERT_EQ("1 0\n"
+              "9223372036854775807 -9223372036854775808 -1\n"
+              "3.14 1e+20 1.23457e+06 100000 1e-05\n", sink.content);
+}
+
+TEST(Emitter, SameAsOstream)
+{
+    output::MemorySink sink;
+    output::Emitter emitter(util::mkref<output::Sink>(sink));
+    writeSample(emitter);
+    emitter.flush();
+
+    std::ostringstream os;
+    writeSample(os);
+    ASSERT_EQ(os.str(), sink.content);
+}
+
+TEST(Emitter, SameAsFdSink)
+{
+    std::FILE* file = std::tmpfile();
+    ASSERT_TRUE(NULL != file);
+    output::FdSink fd_sink(fileno(file));
+    output::MemorySink memory_sink;
+    {
+        output::Emitter fd_emitter(util::mkref<output::Sink>(fd_sink));
+        output::Emitter memory_emitter(util::mkref<output::Sink>(memory_sink));
+        writeSample(fd_emitter);
+        writeSample(memory_emitter);
+    }
+
+    std::string written;
+    char buffer[256];
+    ssize_t size;
+    ASSERT_EQ(0, lseek(fileno(file), 0, SEEK_SET));
+    while (0 < (size = read(fileno(file), buffer, sizeof buffer))) {
+        written.append(buffer, size);
+    }
+    std::fclose(file);
+    ASSERT_EQ(memory_sink.content, written);
+}
+
+TEST(Emitter, FlushOnThreshold)
+{
+    std::size_t const threshold = 64 * 1024;
+    CountingSink sink;
+    output::Emitter emitter(util::mkref<output::Sink>(sink));
+
+    std::string const chunk(1024, 'x');
+    for (std::size_t i = 0; i < threshold / chunk.size() - 1; ++i) {
+        emitter << chunk;
+    }
+    emitter << std::string(chunk.size() - 1, 'y');
+    ASSERT_EQ(0, sink.writes);
+    ASSERT_TRUE(sink.content.empty());
+
+    emitter << 'z';
+    ASSERT_EQ(1, sink.writes);
+    ASSERT_EQ(threshold, sink.content.size());
+    ASSERT_EQ('z', sink.content[threshold - 1]);
+
+    emitter << "tail";
+    ASSERT_EQ(1, sink.writes);
+    emitter.flush();
+    ASSERT_EQ(2, sink.writes);
+    ASSERT_EQ("tail", sink.content.substr(threshold));
+
+    emitter.flush();
+    ASSERT_EQ(2, sink.writes);
+}
+
+TEST(Emitter, FlushOnDestruction)
+{
+    output::MemorySink sink;
+    {
+        output::Emitter emitter(util::mkref<output::Sink>(sink));
+        emitter << "int main()" << '\n';
+        ASSERT_TRUE(sink.content.empty());
+    }
+    ASSERT_EQ("int main()\n", sink.content);
+}
+
+TEST(Emitter, Redirect)
+{
+    output::MemorySink first;
+    output::MemorySink second;
+    output::Emitter emitter(util::mkref<output::Sink>(first));
+    emitter << "head" << 1;
+
+    util::sref<output::Sink> previous(emitter.redirect(util::mkref<output::Sink>(second)));
+    ASSERT_EQ("head1", first.content);
+    emitter << "body" << 2.5;
+    emitter.redirect(previous);
+    ASSERT_EQ("head1", first.content);
+    ASSERT_EQ("body2.5", second.content);
+}
+
+TEST(Emitter, RedirectGlobal)
+{
+    output::MemorySink sink;
+    util::sref<output::Sink> stdout_sink(output::emitter().redirect(util::mkref<output::Sink>(sink)));
+    output::emitter() << "_stk_main" << '(' << 0 << ')';
+    output::emitter().redirect(stdout_sink);
+
+    ASSERT_EQ("_stk_main(0)", sink.content);
+}
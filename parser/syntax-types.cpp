@@ -6,13 +6,13 @@
 
 using namespace parser;
 
-ParamNames* ParamNames::add(std::string const& name)
+ParamNames* ParamNames::add(util::symbol name)
 {
     _names.push_back(name);
     return this;
 }
 
-std::vector<std::string> ParamNames::get() const
+std::vector<util::symbol> ParamNames::get() const
 {
     return _names;
 }
@@ -7,6 +7,7 @@
 #include <grammar/fwd-decl.h>
 #include <report/errors.h>
 #include <util/pointer.h>
+#include <util/symbol.h>
 #include <misc/pos-type.h>
 
 namespace parser {
@@ -21,7 +22,7 @@ namespace parser {
 
     struct Identifier {
         misc::position const pos;
-        std::string const id;
+        util::symbol const id;
 
         Identifier(misc::position const& ps, char const* id_text)
             : pos(ps)
@@ -30,10 +31,10 @@ namespace parser {
     };
 
     struct ParamNames {
-        ParamNames* add(std::string const& name);
-        std::vector<std::string> get() const;
+        ParamNames* add(util::symbol name);
+        std::vector<util::symbol> get() const;
     private:
-        std::vector<std::string> _names;
+        std::vector<util::symbol> _names;
     };
 
     struct ArgList {
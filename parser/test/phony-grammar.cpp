@@ -63,7 +63,7 @@ util::sptr<flchk::Expression const> Negation::compile() const
 
 util::sptr<flchk::Expression const> Reference::compile() const
 {
-    DataTree::actualOne()(pos, IDENTIFIER, name);
+    DataTree::actualOne()(pos, IDENTIFIER, name.str());
     return std::move(nulptr);
 }
 
@@ -122,7 +122,7 @@ util::sptr<flchk::Expression const> ListAppend::compile() const
 
 util::sptr<flchk::Expression const> Call::compile() const
 {
-    DataTree::actualOne()(pos, FUNC_CALL_BEGIN, name);
+    DataTree::actualOne()(pos, FUNC_CALL_BEGIN, name.str());
     std::for_each(args.begin()
                 , args.end()
                 , [&](util::sptr<Expression const> const& expr)
@@ -175,7 +175,7 @@ util::sptr<flchk::Expression const> ListPipeline::compile() const
 
 util::sptr<flchk::Expression const> FuncReference::compile() const
 {
-    DataTree::actualOne()(pos, IDENTIFIER, name + '@' + util::str(param_count));
+    DataTree::actualOne()(pos, IDENTIFIER, name.str() + '@' + util::str(param_count));
     return std::move(nulptr);
 }
 
@@ -186,10 +186,10 @@ void ClauseBuilder::addArith(int indent_level, util::sptr<Expression const> arit
 }
 
 void ClauseBuilder::addVarDef(int indent_level
-                            , std::string const& name
+                            , util::symbol name
                             , util::sptr<Expression const> init)
 {
-    DataTree::actualOne()(init->pos, indent_level, VAR_DEF, name);
+    DataTree::actualOne()(init->pos, indent_level, VAR_DEF, name.str());
     init->compile();
 }
 
@@ -206,15 +206,15 @@ void ClauseBuilder::addReturnNothing(int indent_level, misc::position const& pos
 
 void ClauseBuilder::addFunction(int indent_level
                               , misc::position const& pos
-                              , std::string const& name
-                              , std::vector<std::string> const& params)
+                              , util::symbol name
+                              , std::vector<util::symbol> const& params)
 {
-    DataTree::actualOne()(pos, indent_level, FUNC_DEF_HEAD_BEGIN, name);
+    DataTree::actualOne()(pos, indent_level, FUNC_DEF_HEAD_BEGIN, name.str());
     std::for_each(params.begin()
                 , params.end()
-                , [&](std::string const& param)
+                , [&](util::symbol param)
                   {
-                      DataTree::actualOne()(pos, indent_level, IDENTIFIER, param);
+                      DataTree::actualOne()(pos, indent_level, IDENTIFIER, param.str());
                   });
     DataTree::actualOne()(pos, indent_level, FUNC_DEF_HEAD_END);
 }
@@ -17,8 +17,8 @@ void Block::addStmt(util::sptr<Statement> stmt)
 }
 
 util::sref<Function> Block::declare(misc::position const& pos
-                                  , std::string const& name
-                                  , std::vector<std::string> const& param_names
+                                  , util::symbol name
+                                  , std::vector<util::symbol> const& param_names
                                   , bool contains_void_return)
 {
     util::sptr<Function> func(new Function(pos, name, param_names, contains_void_return));
@@ -4,6 +4,7 @@
 #include <vector>
 
 #include <util/pointer.h>
+#include <util/symbol.h>
 
 #include "fwd-decl.h"
 #include "node-base.h"
@@ -19,8 +20,8 @@ namespace proto {
 
         void addStmt(util::sptr<Statement> stmt);
         util::sref<Function> declare(misc::position const& pos
-                                   , std::string const& name
-                                   , std::vector<std::string> const& param_names
+                                   , util::symbol name
+                                   , std::vector<util::symbol> const& param_names
                                    , bool contains_void_return);
 
         void addTo(util::sref<FuncInstDraft> func);
@@ -2,6 +2,7 @@
 
 #include <instance/expr-nodes.h>
 #include <instance/built-in.h>
+#include <instance/list-pipe.h>
 #include <report/errors.h>
 
 #include "expr-nodes.h"
@@ -27,6 +28,16 @@ util::sptr<inst::Expression const> BoolLiteral::inst(util::sref<SymbolTable cons
     return util::mkptr(new inst::BoolLiteral(value));
 }
 
+bool BoolLiteral::isPipeInvariant() const
+{
+    return true;
+}
+
+bool BoolLiteral::isElementwise() const
+{
+    return true;
+}
+
 util::sref<Type const> IntLiteral::type(util::sref<SymbolTable const>, misc::trace&) const
 {
     return Type::s_int();
@@ -38,6 +49,16 @@ util::sptr<inst::Expression const> IntLiteral::inst(util::sref<SymbolTable const
     return util::mkptr(new inst::IntLiteral(value.get_si()));
 }
 
+bool IntLiteral::isPipeInvariant() const
+{
+    return true;
+}
+
+bool IntLiteral::isElementwise() const
+{
+    return true;
+}
+
 util::sref<Type const> FloatLiteral::type(util::sref<SymbolTable const>, misc::trace&) const
 {
     return Type::s_float();
@@ -49,6 +70,16 @@ util::sptr<inst::Expression const> FloatLiteral::inst(util::sref<SymbolTable con
     return util::mkptr(new inst::FloatLiteral(value.get_d()));
 }
 
+bool FloatLiteral::isPipeInvariant() const
+{
+    return true;
+}
+
+bool FloatLiteral::isElementwise() const
+{
+    return true;
+}
+
 static std::vector<util::sptr<inst::Expression const>> instForExprs(
                                             std::vector<util::sptr<Expression const>> const& exprs
                                           , util::sref<SymbolTable const> st
@@ -111,6 +142,16 @@ static std::vector<util::sref<Type const>> instForTypesAsPipe(
     return arg_types;
 }
 
+static bool anyUsesListIndex(std::vector<util::sptr<Expression const>> const& exprs)
+{
+    return std::any_of(exprs.begin()
+                     , exprs.end()
+                     , [&](util::sptr<Expression const> const& expr)
+                       {
+                           return expr->usesListIndex();
+                       });
+}
+
 static void checkMemberTypes(misc::position const& pos
                            , std::vector<util::sref<Type const>> const& member_types)
 {
@@ -162,6 +203,11 @@ util::sptr<inst::Expression const> ListLiteral::instAsPipe(util::sref<SymbolTabl
                                            , instForExprsAsPipe(value, st, lc, trace)));
 }
 
+bool ListLiteral::usesListIndex() const
+{
+    return anyUsesListIndex(value);
+}
+
 util::sref<Type const> ListLiteral::_memberType(util::sref<SymbolTable const> st
                                               , misc::trace& trace) const
 {
@@ -179,6 +225,53 @@ util::sref<Type const> ListLiteral::_memberTypeAsPipe(util::sref<SymbolTable con
     return member_types[0];
 }
 
+static util::sref<Type const> literalType(platform::int_type)
+{
+    return Type::s_int();
+}
+
+static util::sref<Type const> literalType(platform::float_type)
+{
+    return Type::s_float();
+}
+
+static util::sref<Type const> literalType(bool)
+{
+    return Type::s_bool();
+}
+
+template <typename _Value>
+util::sref<Type const> LiteralList<_Value>::type(util::sref<SymbolTable const>, misc::trace&) const
+{
+    return ListType::getListType(literalType(_Value()));
+}
+
+/*
+ * The members are all literals, so they are laid out once in static storage
+ * shared by every instance of the list, inside pipe stages as well.  Such a
+ * stage is never elementwise, so it does not run in parallel chunks.
+ */
+template <typename _Value>
+util::sptr<inst::Expression const> LiteralList<_Value>::inst(util::sref<SymbolTable const>
+                                                           , misc::trace&) const
+{
+    return util::mkptr(new inst::StaticListLiteral<_Value>(literalType(_Value())->makeInstType()
+                                                         , util::id(this)
+                                                         , value));
+}
+
+template <typename _Value>
+util::sptr<inst::Expression const> LiteralList<_Value>::instAsPipe(util::sref<SymbolTable const> st
+                                                                 , util::sref<ListContext const>
+                                                                 , misc::trace& trace) const
+{
+    return inst(st, trace);
+}
+
+template struct proto::LiteralList<platform::int_type>;
+template struct proto::LiteralList<platform::float_type>;
+template struct proto::LiteralList<bool>;
+
 util::sref<Type const> ListElement::type(util::sref<SymbolTable const>, misc::trace&) const
 {
     error::pipeReferenceNotInListContext(pos);
@@ -206,6 +299,20 @@ util::sptr<inst::Expression const> ListElement::instAsPipe(util::sref<SymbolTabl
     return util::mkptr(new inst::ListElement);
 }
 
+util::sptr<inst::Expression const> ListElement::instAsKernel(
+                                    util::sref<SymbolTable const>
+                                  , util::sref<Type const>
+                                  , std::vector<util::sptr<inst::Expression const>>&
+                                  , misc::trace&) const
+{
+    return util::mkptr(new inst::ListElement);
+}
+
+bool ListElement::isElementwise() const
+{
+    return true;
+}
+
 util::sref<Type const> ListIndex::type(util::sref<SymbolTable const>, misc::trace&) const
 {
     error::pipeReferenceNotInListContext(pos);
@@ -233,6 +340,33 @@ util::sptr<inst::Expression const> ListIndex::instAsPipe(util::sref<SymbolTable
     return util::mkptr(new inst::ListIndex);
 }
 
+bool ListIndex::isListIndex() const
+{
+    return true;
+}
+
+util::sptr<inst::Expression const> ListIndex::instAsKernel(
+                                    util::sref<SymbolTable const>
+                                  , util::sref<Type const> member_type
+                                  , std::vector<util::sptr<inst::Expression const>>&
+                                  , misc::trace&) const
+{
+    if (Type::s_int() != member_type) {
+        return util::sptr<inst::Expression const>(nullptr);
+    }
+    return util::mkptr(new inst::ListIndex);
+}
+
+bool ListIndex::isElementwise() const
+{
+    return true;
+}
+
+bool ListIndex::usesListIndex() const
+{
+    return true;
+}
+
 util::sref<Type const> Reference::type(util::sref<SymbolTable const> st, misc::trace&) const
 {
     return st->queryVar(pos, name).type;
@@ -246,6 +380,16 @@ util::sptr<inst::Expression const> Reference::inst(util::sref<SymbolTable const>
                                          , inst::Address(var.level, var.stack_offset)));
 }
 
+bool Reference::isPipeInvariant() const
+{
+    return true;
+}
+
+bool Reference::isElementwise() const
+{
+    return true;
+}
+
 util::sref<Type const> Call::type(util::sref<SymbolTable const> st, misc::trace& trace) const
 {
     trace.add(pos);
@@ -278,6 +422,11 @@ util::sptr<inst::Expression const> Call::instAsPipe(util::sref<SymbolTable const
     return util::mkptr(new inst::Call(draft->sn, instForExprsAsPipe(_args, st, lc, trace)));
 }
 
+bool Call::usesListIndex() const
+{
+    return anyUsesListIndex(_args);
+}
+
 util::sref<Type const> MemberCall::type(util::sref<SymbolTable const> st, misc::trace& trace) const
 {
     trace.add(pos);
@@ -313,6 +462,11 @@ util::sptr<inst::Expression const> MemberCall::instAsPipe(util::sref<SymbolTable
                                           , instForExprsAsPipe(args, st, lc, trace)));
 }
 
+bool MemberCall::usesListIndex() const
+{
+    return object->usesListIndex() || anyUsesListIndex(args);
+}
+
 util::sref<Type const> Functor::type(util::sref<SymbolTable const> st, misc::trace& trace) const
 {
     return _mkDraft(st, trace)->getReturnType();
@@ -340,6 +494,11 @@ util::sptr<inst::Expression const> Functor::instAsPipe(util::sref<SymbolTable co
     return util::mkptr(new inst::Call(draft->sn, instForExprsAsPipe(_args, st, lc, trace)));
 }
 
+bool Functor::usesListIndex() const
+{
+    return anyUsesListIndex(_args);
+}
+
 util::sref<FuncInstDraft> Functor::_mkDraft(util::sref<SymbolTable const> st
                                           , misc::trace& trace) const
 {
@@ -409,16 +568,21 @@ util::sptr<inst::Expression const> ListAppend::instAsPipe(util::sref<SymbolTable
                                           , rhs->instAsPipe(st, lc, trace)));
 }
 
+bool ListAppend::usesListIndex() const
+{
+    return lhs->usesListIndex() || rhs->usesListIndex();
+}
+
 util::sref<Type const> BinaryOp::type(util::sref<SymbolTable const> st, misc::trace& trace) const
 {
-    return st->queryBinary(pos, op, lhs->type(st, trace), rhs->type(st, trace))->ret_type;
+    return st->queryBinary(pos, op_id, lhs->type(st, trace), rhs->type(st, trace))->ret_type;
 }
 
 util::sptr<inst::Expression const> BinaryOp::inst(util::sref<SymbolTable const> st
                                                 , misc::trace& trace) const
 {
     util::sref<Operation const> o(
-            st->queryBinary(pos, op, lhs->type(st, trace), rhs->type(st, trace)));
+            st->queryBinary(pos, op_id, lhs->type(st, trace), rhs->type(st, trace)));
     return util::mkptr(new inst::BinaryOp(lhs->inst(st, trace), o->op_img, rhs->inst(st, trace)));
 }
 
@@ -426,8 +590,10 @@ util::sref<Type const> BinaryOp::typeAsPipe(util::sref<SymbolTable const> st
                                           , util::sref<ListContext const> lc
                                           , misc::trace& trace) const
 {
-    return st->queryBinary(pos, op, lhs->typeAsPipe(st, lc, trace), rhs->typeAsPipe(st, lc, trace))
-             ->ret_type;
+    return st->queryBinary(pos
+                         , op_id
+                         , lhs->typeAsPipe(st, lc, trace)
+                         , rhs->typeAsPipe(st, lc, trace))->ret_type;
 }
 
 util::sptr<inst::Expression const> BinaryOp::instAsPipe(util::sref<SymbolTable const> st
@@ -435,21 +601,126 @@ util::sptr<inst::Expression const> BinaryOp::instAsPipe(util::sref<SymbolTable c
                                                       , misc::trace& trace) const
 {
     util::sref<Operation const> o(st->queryBinary(
-                    pos, op, lhs->typeAsPipe(st, lc, trace), rhs->typeAsPipe(st, lc, trace)));
+                    pos, op_id, lhs->typeAsPipe(st, lc, trace), rhs->typeAsPipe(st, lc, trace)));
     return util::mkptr(new inst::BinaryOp(lhs->instAsPipe(st, lc, trace)
                                         , o->op_img
                                         , rhs->instAsPipe(st, lc, trace)));
 }
 
+bool BinaryOp::isPipeInvariant() const
+{
+    return lhs->isPipeInvariant() && rhs->isPipeInvariant();
+}
+
+/*
+ * An int division or modulo traps on a zero divisor.  Int and float share
+ * the operator images, so a float division is taken as one that may trap.
+ */
+bool BinaryOp::mayTrap() const
+{
+    return "/" == op || "%" == op || lhs->mayTrap() || rhs->mayTrap();
+}
+
+bool BinaryOp::isElementwise() const
+{
+    return lhs->isElementwise() && rhs->isElementwise();
+}
+
+bool BinaryOp::usesListIndex() const
+{
+    return lhs->usesListIndex() || rhs->usesListIndex();
+}
+
+static std::string flipCompare(std::string const& op)
+{
+    if ("<" == op) {
+        return ">";
+    }
+    if ("<=" == op) {
+        return ">=";
+    }
+    if (">" == op) {
+        return "<";
+    }
+    if (">=" == op) {
+        return "<=";
+    }
+    return op;
+}
+
+/*
+ * A bound is evaluated once before the slice, even when no member would have
+ * reached the test, so a bound that may trap stays in the filter.
+ */
+static bool addIndexBound(std::string const& op
+                        , util::sptr<Expression const> const& bound
+                        , util::sref<SymbolTable const> st
+                        , misc::trace& trace
+                        , std::vector<util::sptr<inst::SliceBound const>>& bounds)
+{
+    if (!("<" == op || "<=" == op || ">" == op || ">=" == op || "=" == op)) {
+        return false;
+    }
+    if (!bound->isPipeInvariant() || bound->mayTrap() || Type::s_int() != bound->type(st, trace)) {
+        return false;
+    }
+    bounds.push_back(util::mkptr(new inst::SliceBound(op, bound->inst(st, trace))));
+    return true;
+}
+
+bool BinaryOp::indexBounds(util::sref<SymbolTable const> st
+                         , misc::trace& trace
+                         , std::vector<util::sptr<inst::SliceBound const>>& bounds) const
+{
+    if (lhs->isListIndex()) {
+        return addIndexBound(op, rhs, st, trace, bounds);
+    }
+    if (rhs->isListIndex()) {
+        return addIndexBound(flipCompare(op), lhs, st, trace, bounds);
+    }
+    return false;
+}
+
+/*
+ * Int members are 64 bits wide and there is no lane-wise 64-bit multiplication
+ * before AVX-512, so an int kernel only adds and subtracts.
+ */
+static bool isKernelBinaryOp(std::string const& op, util::sref<Type const> member_type)
+{
+    return "+" == op || "-" == op
+        || (Type::s_float() == member_type && ("*" == op || "/" == op));
+}
+
+util::sptr<inst::Expression const> BinaryOp::instAsKernel(
+                                    util::sref<SymbolTable const> st
+                                  , util::sref<Type const> member_type
+                                  , std::vector<util::sptr<inst::Expression const>>& invariants
+                                  , misc::trace& trace) const
+{
+    if (isPipeInvariant()) {
+        return Expression::instAsKernel(st, member_type, invariants, trace);
+    }
+    if (!isKernelBinaryOp(op, member_type)) {
+        return util::sptr<inst::Expression const>(nullptr);
+    }
+    util::sptr<inst::Expression const> l(lhs->instAsKernel(st, member_type, invariants, trace));
+    util::sptr<inst::Expression const> r(rhs->instAsKernel(st, member_type, invariants, trace));
+    if (l.nul() || r.nul()) {
+        return util::sptr<inst::Expression const>(nullptr);
+    }
+    util::sref<Operation const> o(st->queryBinary(pos, op_id, member_type, member_type));
+    return util::mkptr(new inst::BinaryOp(std::move(l), o->op_img, std::move(r)));
+}
+
 util::sref<Type const> PreUnaryOp::type(util::sref<SymbolTable const> st, misc::trace& trace) const
 {
-    return st->queryPreUnary(pos, op, rhs->type(st, trace))->ret_type;
+    return st->queryPreUnary(pos, op_id, rhs->type(st, trace))->ret_type;
 }
 
 util::sptr<inst::Expression const> PreUnaryOp::inst(util::sref<SymbolTable const> st
                                                   , misc::trace& trace) const
 {
-    util::sref<Operation const> o(st->queryPreUnary(pos, op, rhs->type(st, trace)));
+    util::sref<Operation const> o(st->queryPreUnary(pos, op_id, rhs->type(st, trace)));
     return util::mkptr(new inst::PreUnaryOp(o->op_img, rhs->inst(st, trace)));
 }
 
@@ -457,17 +728,57 @@ util::sref<Type const> PreUnaryOp::typeAsPipe(util::sref<SymbolTable const> st
                                             , util::sref<ListContext const> lc
                                             , misc::trace& trace) const
 {
-    return st->queryPreUnary(pos, op, rhs->typeAsPipe(st, lc, trace))->ret_type;
+    return st->queryPreUnary(pos, op_id, rhs->typeAsPipe(st, lc, trace))->ret_type;
 }
 
 util::sptr<inst::Expression const> PreUnaryOp::instAsPipe(util::sref<SymbolTable const> st
                                                         , util::sref<ListContext const> lc
                                                         , misc::trace& trace) const
 {
-    util::sref<Operation const> o(st->queryPreUnary(pos, op, rhs->typeAsPipe(st, lc, trace)));
+    util::sref<Operation const> o(st->queryPreUnary(pos, op_id, rhs->typeAsPipe(st, lc, trace)));
     return util::mkptr(new inst::PreUnaryOp(o->op_img, rhs->instAsPipe(st, lc, trace)));
 }
 
+bool PreUnaryOp::isPipeInvariant() const
+{
+    return rhs->isPipeInvariant();
+}
+
+bool PreUnaryOp::mayTrap() const
+{
+    return rhs->mayTrap();
+}
+
+bool PreUnaryOp::isElementwise() const
+{
+    return rhs->isElementwise();
+}
+
+bool PreUnaryOp::usesListIndex() const
+{
+    return rhs->usesListIndex();
+}
+
+util::sptr<inst::Expression const> PreUnaryOp::instAsKernel(
+                                    util::sref<SymbolTable const> st
+                                  , util::sref<Type const> member_type
+                                  , std::vector<util::sptr<inst::Expression const>>& invariants
+                                  , misc::trace& trace) const
+{
+    if (isPipeInvariant()) {
+        return Expression::instAsKernel(st, member_type, invariants, trace);
+    }
+    if (!("+" == op || "-" == op)) {
+        return util::sptr<inst::Expression const>(nullptr);
+    }
+    util::sptr<inst::Expression const> r(rhs->instAsKernel(st, member_type, invariants, trace));
+    if (r.nul()) {
+        return util::sptr<inst::Expression const>(nullptr);
+    }
+    util::sref<Operation const> o(st->queryPreUnary(pos, op_id, member_type));
+    return util::mkptr(new inst::PreUnaryOp(o->op_img, std::move(r)));
+}
+
 util::sref<Type const> Conjunction::type(util::sref<SymbolTable const>, misc::trace&) const
 {
     return Type::s_bool();
@@ -491,6 +802,23 @@ util::sptr<inst::Expression const> Conjunction::instAsPipe(util::sref<SymbolTabl
                                            , rhs->instAsPipe(st, lc, trace)));
 }
 
+bool Conjunction::indexBounds(util::sref<SymbolTable const> st
+                            , misc::trace& trace
+                            , std::vector<util::sptr<inst::SliceBound const>>& bounds) const
+{
+    return lhs->indexBounds(st, trace, bounds) && rhs->indexBounds(st, trace, bounds);
+}
+
+bool Conjunction::isElementwise() const
+{
+    return lhs->isElementwise() && rhs->isElementwise();
+}
+
+bool Conjunction::usesListIndex() const
+{
+    return lhs->usesListIndex() || rhs->usesListIndex();
+}
+
 util::sref<Type const> Disjunction::type(util::sref<SymbolTable const>, misc::trace&) const
 {
     return Type::s_bool();
@@ -514,6 +842,16 @@ util::sptr<inst::Expression const> Disjunction::instAsPipe(util::sref<SymbolTabl
                                            , rhs->instAsPipe(st, lc, trace)));
 }
 
+bool Disjunction::isElementwise() const
+{
+    return lhs->isElementwise() && rhs->isElementwise();
+}
+
+bool Disjunction::usesListIndex() const
+{
+    return lhs->usesListIndex() || rhs->usesListIndex();
+}
+
 util::sref<Type const> Negation::type(util::sref<SymbolTable const>, misc::trace&) const
 {
     return Type::s_bool();
@@ -533,3 +871,13 @@ util::sptr<inst::Expression const> Negation::instAsPipe(util::sref<SymbolTable c
     rhs->typeAsPipe(st, lc, trace)->checkCondType(pos);
     return util::mkptr(new inst::Negation(rhs->instAsPipe(st, lc, trace)));
 }
+
+bool Negation::isElementwise() const
+{
+    return rhs->isElementwise();
+}
+
+bool Negation::usesListIndex() const
+{
+    return rhs->usesListIndex();
+}
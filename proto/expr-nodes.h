@@ -6,10 +6,13 @@
 #include <gmpxx.h>
 
 #include <instance/fwd-decl.h>
+#include <misc/platform.h>
+#include <util/symbol.h>
 
 #include "node-base.h"
 #include "fwd-decl.h"
 #include "func-reference-type.h"
+#include "operation.h"
 
 namespace proto {
 
@@ -23,6 +26,8 @@ namespace proto {
 
         util::sref<Type const> type(util::sref<SymbolTable const>, misc::trace&) const;
         util::sptr<inst::Expression const> inst(util::sref<SymbolTable const>, misc::trace&) const;
+        bool isPipeInvariant() const;
+        bool isElementwise() const;
 
         bool const value;
     };
@@ -37,6 +42,8 @@ namespace proto {
 
         util::sref<Type const> type(util::sref<SymbolTable const>, misc::trace&) const;
         util::sptr<inst::Expression const> inst(util::sref<SymbolTable const>, misc::trace&) const;
+        bool isPipeInvariant() const;
+        bool isElementwise() const;
 
         mpz_class const value;
     };
@@ -51,6 +58,8 @@ namespace proto {
 
         util::sref<Type const> type(util::sref<SymbolTable const>, misc::trace&) const;
         util::sptr<inst::Expression const> inst(util::sref<SymbolTable const>, misc::trace&) const;
+        bool isPipeInvariant() const;
+        bool isElementwise() const;
 
         mpf_class const value;
     };
@@ -72,6 +81,7 @@ namespace proto {
         util::sptr<inst::Expression const> instAsPipe(util::sref<SymbolTable const> st
                                                     , util::sref<ListContext const> lc
                                                     , misc::trace& trace) const;
+        bool usesListIndex() const;
 
         std::vector<util::sptr<Expression const>> const value;
     private:
@@ -82,6 +92,24 @@ namespace proto {
                                                , misc::trace& trace) const;
     };
 
+    template <typename _Value>
+    struct LiteralList
+        : public Expression
+    {
+        LiteralList(misc::position const& pos, std::vector<_Value> const& v)
+            : Expression(pos)
+            , value(v)
+        {}
+
+        util::sref<Type const> type(util::sref<SymbolTable const>, misc::trace&) const;
+        util::sptr<inst::Expression const> inst(util::sref<SymbolTable const>, misc::trace&) const;
+        util::sptr<inst::Expression const> instAsPipe(util::sref<SymbolTable const>
+                                                    , util::sref<ListContext const>
+                                                    , misc::trace&) const;
+
+        std::vector<_Value> const value;
+    };
+
     struct ListElement
         : public Expression
     {
@@ -98,6 +126,12 @@ namespace proto {
         util::sptr<inst::Expression const> instAsPipe(util::sref<SymbolTable const>
                                                     , util::sref<ListContext const> lc
                                                     , misc::trace&) const;
+        util::sptr<inst::Expression const> instAsKernel(
+                                    util::sref<SymbolTable const> st
+                                  , util::sref<Type const> member_type
+                                  , std::vector<util::sptr<inst::Expression const>>& invariants
+                                  , misc::trace& trace) const;
+        bool isElementwise() const;
     };
 
     struct ListIndex
@@ -116,12 +150,20 @@ namespace proto {
         util::sptr<inst::Expression const> instAsPipe(util::sref<SymbolTable const>
                                                     , util::sref<ListContext const>
                                                     , misc::trace&) const;
+        bool isListIndex() const;
+        util::sptr<inst::Expression const> instAsKernel(
+                                    util::sref<SymbolTable const> st
+                                  , util::sref<Type const> member_type
+                                  , std::vector<util::sptr<inst::Expression const>>& invariants
+                                  , misc::trace& trace) const;
+        bool isElementwise() const;
+        bool usesListIndex() const;
     };
 
     struct Reference
         : public Expression
     {
-        Reference(misc::position const& pos, std::string const& n)
+        Reference(misc::position const& pos, util::symbol n)
             : Expression(pos)
             , name(n)
         {}
@@ -129,8 +171,10 @@ namespace proto {
         util::sref<Type const> type(util::sref<SymbolTable const> st, misc::trace&) const;
         util::sptr<inst::Expression const> inst(util::sref<SymbolTable const> st
                                               , misc::trace&) const;
+        bool isPipeInvariant() const;
+        bool isElementwise() const;
 
-        std::string const name;
+        util::symbol const name;
     };
 
     struct Call
@@ -153,6 +197,7 @@ namespace proto {
         util::sptr<inst::Expression const> instAsPipe(util::sref<SymbolTable const> st
                                                     , util::sref<ListContext const> lc
                                                     , misc::trace& trace) const;
+        bool usesListIndex() const;
     private:
         util::sref<Function> const _func;
         std::vector<util::sptr<Expression const>> const _args;
@@ -180,6 +225,7 @@ namespace proto {
         util::sptr<inst::Expression const> instAsPipe(util::sref<SymbolTable const> st
                                                     , util::sref<ListContext const> lc
                                                     , misc::trace& trace) const;
+        bool usesListIndex() const;
 
         util::sptr<Expression const> object;
         std::string const member_call;
@@ -190,7 +236,7 @@ namespace proto {
         : public Expression
     {
         Functor(misc::position const& pos
-              , std::string const& n
+              , util::symbol n
               , std::vector<util::sptr<Expression const>> a)
             : Expression(pos)
             , name(n)
@@ -206,8 +252,9 @@ namespace proto {
         util::sptr<inst::Expression const> instAsPipe(util::sref<SymbolTable const> st
                                                     , util::sref<ListContext const> lc
                                                     , misc::trace& trace) const;
+        bool usesListIndex() const;
 
-        std::string const name;
+        util::symbol const name;
     private:
         std::vector<util::sptr<Expression const>> const _args;
     private:
@@ -253,6 +300,7 @@ namespace proto {
         util::sptr<inst::Expression const> instAsPipe(util::sref<SymbolTable const> st
                                                     , util::sref<ListContext const> lc
                                                     , misc::trace& trace) const;
+        bool usesListIndex() const;
 
         util::sptr<Expression const> const lhs;
         util::sptr<Expression const> const rhs;
@@ -268,6 +316,7 @@ namespace proto {
             : Expression(pos)
             , lhs(std::move(l))
             , op(o)
+            , op_id(Operation::binaryOpId(o))
             , rhs(std::move(r))
         {}
 
@@ -280,9 +329,22 @@ namespace proto {
         util::sptr<inst::Expression const> instAsPipe(util::sref<SymbolTable const> st
                                                     , util::sref<ListContext const> lc
                                                     , misc::trace& trace) const;
+        bool isPipeInvariant() const;
+        bool mayTrap() const;
+        bool indexBounds(util::sref<SymbolTable const> st
+                       , misc::trace& trace
+                       , std::vector<util::sptr<inst::SliceBound const>>& bounds) const;
+        util::sptr<inst::Expression const> instAsKernel(
+                                    util::sref<SymbolTable const> st
+                                  , util::sref<Type const> member_type
+                                  , std::vector<util::sptr<inst::Expression const>>& invariants
+                                  , misc::trace& trace) const;
+        bool isElementwise() const;
+        bool usesListIndex() const;
 
         util::sptr<Expression const> const lhs;
         std::string const op;
+        int const op_id;
         util::sptr<Expression const> const rhs;
     };
 
@@ -292,6 +354,7 @@ namespace proto {
         PreUnaryOp(misc::position const& pos, std::string const& o, util::sptr<Expression const> r)
             : Expression(pos)
             , op(o)
+            , op_id(Operation::preUnaryOpId(o))
             , rhs(std::move(r))
         {}
 
@@ -304,8 +367,18 @@ namespace proto {
         util::sptr<inst::Expression const> instAsPipe(util::sref<SymbolTable const> st
                                                     , util::sref<ListContext const> lc
                                                     , misc::trace& trace) const;
+        bool isPipeInvariant() const;
+        bool mayTrap() const;
+        util::sptr<inst::Expression const> instAsKernel(
+                                    util::sref<SymbolTable const> st
+                                  , util::sref<Type const> member_type
+                                  , std::vector<util::sptr<inst::Expression const>>& invariants
+                                  , misc::trace& trace) const;
+        bool isElementwise() const;
+        bool usesListIndex() const;
 
         std::string const op;
+        int const op_id;
         util::sptr<Expression const> const rhs;
     };
 
@@ -326,6 +399,11 @@ namespace proto {
         util::sptr<inst::Expression const> instAsPipe(util::sref<SymbolTable const> st
                                                     , util::sref<ListContext const> lc
                                                     , misc::trace& trace) const;
+        bool indexBounds(util::sref<SymbolTable const> st
+                       , misc::trace& trace
+                       , std::vector<util::sptr<inst::SliceBound const>>& bounds) const;
+        bool isElementwise() const;
+        bool usesListIndex() const;
 
         util::sptr<Expression const> const lhs;
         util::sptr<Expression const> const rhs;
@@ -348,6 +426,8 @@ namespace proto {
         util::sptr<inst::Expression const> instAsPipe(util::sref<SymbolTable const> st
                                                     , util::sref<ListContext const> lc
                                                     , misc::trace& trace) const;
+        bool isElementwise() const;
+        bool usesListIndex() const;
 
         util::sptr<Expression const> const lhs;
         util::sptr<Expression const> const rhs;
@@ -367,6 +447,8 @@ namespace proto {
         util::sptr<inst::Expression const> instAsPipe(util::sref<SymbolTable const> st
                                                     , util::sref<ListContext const> lc
                                                     , misc::trace& trace) const;
+        bool isElementwise() const;
+        bool usesListIndex() const;
 
         util::sptr<Expression const> const rhs;
     };
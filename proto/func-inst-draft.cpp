@@ -27,7 +27,7 @@ namespace {
     {
         FuncInstDraftUnresolved(int ext_lvl
                               , std::list<ArgNameTypeRec> const& args
-                              , std::map<std::string, Variable const> const& extvars)
+                              , std::map<util::symbol, Variable const> const& extvars)
             : FuncInstDraft(ext_lvl, args, extvars)
             , _return_type_or_nul_if_not_set(nullptr)
         {}
@@ -92,7 +92,7 @@ bool FuncInstDraft::isReturnTypeResolved() const
 
 util::sptr<FuncInstDraft> FuncInstDraft::create(int ext_lvl
                                               , std::list<ArgNameTypeRec> const& args
-                                              , std::map<std::string, Variable const> const& extvars
+                                              , std::map<util::symbol, Variable const> const& extvars
                                               , bool has_void_returns)
 {
     return util::mkptr(has_void_returns ? new FuncInstDraft(ext_lvl, args, extvars)
@@ -159,6 +159,20 @@ int FuncInstDraft::level() const
     return _symbols.level;
 }
 
+static std::list<inst::Function::SlotInfo> varsToSlots(std::list<Variable> const& vars)
+{
+    std::list<inst::Function::SlotInfo> slots;
+    std::for_each(vars.begin()
+                , vars.end()
+                , [&](Variable const& var)
+                  {
+                      slots.push_back(inst::Function::SlotInfo(var.type->makeInstType()
+                                                             , var.stack_offset
+                                                             , var.type->size));
+                  });
+    return std::move(slots);
+}
+
 void FuncInstDraft::instantiate(util::sref<Statement> stmt, misc::trace& trace)
 {
     addPath(stmt);
@@ -168,6 +182,7 @@ void FuncInstDraft::instantiate(util::sref<Statement> stmt, misc::trace& trace)
                                                          , _symbols.level
                                                          , _symbols.stackSize()
                                                          , varsToParams(_symbols.getArgs())
+                                                         , varsToSlots(_symbols.getLocals())
                                                          , sn
                                                          , _symbols.getResEntries()
                                                          , std::move(body)));
@@ -8,6 +8,7 @@
 #include <instance/function.h>
 #include <misc/pos-type.h>
 #include <util/sn.h>
+#include <util/symbol.h>
 
 #include "fwd-decl.h"
 #include "symbol-table.h"
@@ -32,14 +33,14 @@ namespace proto {
     public:
         static util::sptr<FuncInstDraft> create(int ext_lvl
                                               , std::list<ArgNameTypeRec> const& args
-                                              , std::map<std::string, Variable const> const& extvars
+                                              , std::map<util::symbol, Variable const> const& extvars
                                               , bool has_void_returns);
         static util::sptr<FuncInstDraft> createGlobal();
         static util::sref<FuncInstDraft> badDraft();
     protected:
         FuncInstDraft(int ext_lvl
                     , std::list<ArgNameTypeRec> const& args
-                    , std::map<std::string, Variable const> const& extvars)
+                    , std::map<util::symbol, Variable const> const& extvars)
             : sn(util::serial_num::next())
             , _inst_func_or_nul_if_not_inst(nullptr)
             , _symbols(ext_lvl, args, extvars)
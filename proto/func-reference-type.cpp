@@ -19,7 +19,7 @@ util::sptr<inst::Type const> FuncReferenceType::makeInstType() const
     std::vector<util::sptr<inst::Type const>> enclosed_types;
     std::for_each(context_references.begin()
                 , context_references.end()
-                , [&](std::pair<std::string, Variable const> const& reference)
+                , [&](std::pair<util::symbol const, Variable const> const& reference)
                   {
                       enclosed_types.push_back(reference.second.type->makeInstType());
                   });
@@ -29,22 +29,22 @@ util::sptr<inst::Type const> FuncReferenceType::makeInstType() const
 std::string FuncReferenceType::name() const
 {
     return "Function reference [ "
-         + _func->name
+         + _func->name.str()
          + " with "
          + util::str(int(_func->param_names.size()))
          + " parameters ]";
 }
 
-std::map<std::string, Variable const> FuncReferenceType::_encloseReference(
+std::map<util::symbol, Variable const> FuncReferenceType::_encloseReference(
                                             misc::position const& pos
                                           , int level
-                                          , std::map<std::string, Variable const> const& cr)
+                                          , std::map<util::symbol, Variable const> const& cr)
 {
-    std::map<std::string, Variable const> map;
+    std::map<util::symbol, Variable const> map;
     int offset = 0;
     std::for_each(cr.begin()
                 , cr.end()
-                , [&](std::pair<std::string, Variable const> const& reference)
+                , [&](std::pair<util::symbol const, Variable const> const& reference)
                   {
                       map.insert(std::make_pair(
                                         reference.first
@@ -57,12 +57,12 @@ std::map<std::string, Variable const> FuncReferenceType::_encloseReference(
     return map;
 }
 
-int FuncReferenceType::_calcSize(std::map<std::string, Variable const> const& cr)
+int FuncReferenceType::_calcSize(std::map<util::symbol, Variable const> const& cr)
 {
     int size = 0;
     std::for_each(cr.begin()
                 , cr.end()
-                , [&](std::pair<std::string, Variable const> const& reference)
+                , [&](std::pair<util::symbol const, Variable const> const& reference)
                   {
                       size += reference.second.type->size;
                   });
@@ -88,7 +88,7 @@ std::list<inst::FuncReference::ArgInfo> FuncReferenceType::makeCallArgs() const
     int offset = 0;
     std::for_each(context_references.begin()
                 , context_references.end()
-                , [&](std::pair<std::string, Variable const> const& reference)
+                , [&](std::pair<util::symbol const, Variable const> const& reference)
                   {
                       result.push_back(inst::FuncReference::ArgInfo(
                                 inst::Address(reference.second.level, reference.second.stack_offset)
@@ -99,13 +99,13 @@ std::list<inst::FuncReference::ArgInfo> FuncReferenceType::makeCallArgs() const
     return result;
 }
 
-std::map<std::string, Variable const>
+std::map<util::symbol, Variable const>
             FuncReferenceType::_adjustVars(int stack_offset, int level) const
 {
-    std::map<std::string, Variable const> result;
+    std::map<util::symbol, Variable const> result;
     std::for_each(closed_references.begin()
                 , closed_references.end()
-                , [&](std::pair<std::string, Variable const> const& reference)
+                , [&](std::pair<util::symbol const, Variable const> const& reference)
                   {
                       result.insert(std::make_pair(reference.first
                                                  , reference.second.adjustLocation(stack_offset
@@ -3,6 +3,7 @@
 
 #include <instance/expr-nodes.h>
 #include <misc/pos-type.h>
+#include <util/symbol.h>
 
 #include "type.h"
 #include "variable.h"
@@ -15,7 +16,7 @@ namespace proto {
         FuncReferenceType(misc::position const& reference_pos
                         , util::sref<Function> func
                         , int level
-                        , std::map<std::string, Variable const> const& cr)
+                        , std::map<util::symbol, Variable const> const& cr)
             : Type(_calcSize(cr))
             , context_references(cr)
             , closed_references(std::move(_encloseReference(reference_pos, level, cr)))
@@ -30,20 +31,20 @@ namespace proto {
                                      , std::vector<util::sref<Type const>> const& arg_types
                                      , misc::trace& trace) const;
     public:
-        std::map<std::string, Variable const> const context_references;
-        std::map<std::string, Variable const> const closed_references;
+        std::map<util::symbol, Variable const> const context_references;
+        std::map<util::symbol, Variable const> const closed_references;
     public:
         std::list<inst::FuncReference::ArgInfo> makeCallArgs() const;
     private:
         util::sref<Function> const _func;
     private:
-        static std::map<std::string, Variable const> _encloseReference(
+        static std::map<util::symbol, Variable const> _encloseReference(
                         misc::position const& pos
                       , int level
-                      , std::map<std::string, Variable const> const& cr);
-        static int _calcSize(std::map<std::string, Variable const> const& cr);
+                      , std::map<util::symbol, Variable const> const& cr);
+        static int _calcSize(std::map<util::symbol, Variable const> const& cr);
 
-        std::map<std::string, Variable const> _adjustVars(int stack_offset, int level) const;
+        std::map<util::symbol, Variable const> _adjustVars(int stack_offset, int level) const;
     };
 
 }
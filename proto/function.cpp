@@ -16,30 +16,32 @@ util::sref<FuncInstDraft> Function::inst(util::sref<SymbolTable const> ext_st
                                        , std::vector<util::sref<Type const>> const& arg_types
                                        , misc::trace& trace)
 {
-    return inst(ext_st->level, bindExternalVars(trace.top(), ext_st), arg_types, trace);
+    DraftKey key(_boundVars(trace.top(), ext_st), arg_types);
+    util::sref<FuncInstDraft> draft = _draftInCacheOrNulIfNonexist(key, trace);
+    if (draft.not_nul()) {
+        return draft;
+    }
+    return _inst(ext_st->level, key, _nameBoundVars(key.ext_vars), trace);
 }
 
-util::sref<FuncInstDraft> Function::_draftInCacheOrNulIfNonexist(
-                        std::map<std::string, Variable const> const& ext_vars
-                      , std::vector<util::sref<Type const>> const& arg_types
-                      , misc::trace& trace) const
+util::sref<FuncInstDraft> Function::_draftInCacheOrNulIfNonexist(DraftKey const& key
+                                                               , misc::trace& trace) const
 {
-    auto find_result = _draft_cache.find(ext_vars, arg_types);
-    if (_draft_cache.end() == find_result) {
-        return util::sref<FuncInstDraft>(nullptr);
+    util::sref<FuncInstDraft> draft = _draft_cache.findOrNul(key);
+    if (draft.nul()) {
+        return draft;
     }
-    util::sref<FuncInstDraft> draft = *(find_result->draft);
     while (!draft->isReturnTypeResolved() && draft->hasMorePath()) {
         draft->instNextPath(trace);
     }
     if (!draft->isReturnTypeResolved()) {
-        error::returnTypeUnresolvable(name, arg_types.size(), trace);
+        error::returnTypeUnresolvable(name.str(), key.arg_types.size(), trace);
         draft->setReturnType(Type::bad(), trace);
     }
     return draft;
 }
 
-std::list<ArgNameTypeRec> makeArgInfo(std::vector<std::string> const& param_names
+std::list<ArgNameTypeRec> makeArgInfo(std::vector<util::symbol> const& param_names
                                     , std::vector<util::sref<Type const>> const& arg_types)
 {
     std::list<ArgNameTypeRec> args;
@@ -50,43 +52,89 @@ std::list<ArgNameTypeRec> makeArgInfo(std::vector<std::string> const& param_name
 }
 
 util::sref<FuncInstDraft> Function::inst(int level
-                                       , std::map<std::string, Variable const> const& ext_vars
+                                       , std::map<util::symbol, Variable const> const& ext_vars
                                        , std::vector<util::sref<Type const>> const& arg_types
                                        , misc::trace& trace)
 {
-    util::sref<FuncInstDraft> draft = _draftInCacheOrNulIfNonexist(ext_vars, arg_types, trace);
+    std::vector<Variable> bound_vars;
+    std::for_each(ext_vars.begin()
+                , ext_vars.end()
+                , [&](std::pair<util::symbol const, Variable const> const& var)
+                  {
+                      bound_vars.push_back(var.second);
+                  });
+    DraftKey key(bound_vars, arg_types);
+    util::sref<FuncInstDraft> draft = _draftInCacheOrNulIfNonexist(key, trace);
     if (draft.not_nul()) {
         return draft;
     }
+    return _inst(level, key, ext_vars, trace);
+}
 
+util::sref<FuncInstDraft> Function::_inst(int level
+                                        , DraftKey const& key
+                                        , std::map<util::symbol, Variable const> const& ext_vars
+                                        , misc::trace& trace)
+{
     util::sptr<FuncInstDraft> new_draft(FuncInstDraft::create(level
-                                                            , makeArgInfo(param_names, arg_types)
+                                                            , makeArgInfo(param_names
+                                                                        , key.arg_types)
                                                             , ext_vars
                                                             , hint_void_return));
     util::sref<FuncInstDraft> draft_ref(*new_draft);
-    _draft_cache.append(DraftInfo(ext_vars, arg_types, std::move(new_draft)));
+    _draft_cache.append(key, std::move(new_draft));
     draft_ref->instantiate(block(), trace);
     return draft_ref;
 }
 
-std::map<std::string, Variable const> Function::bindExternalVars(
-                                                  misc::position const& pos
-                                                , util::sref<SymbolTable const> ext_st) const
+/*
+ * Free variables are resolved once per symbol table the function is called
+ * or referenced from; Variables never change once defined.  A binding with
+ * an undefined variable is not kept, so that every call site reports it.
+ */
+std::vector<Variable> Function::_boundVars(misc::position const& pos
+                                         , util::sref<SymbolTable const> ext_st)
 {
-    std::map<std::string, Variable const> result;
+    auto find_result = _bound_vars.find(ext_st.id());
+    if (_bound_vars.end() != find_result) {
+        return find_result->second;
+    }
+    bool all_defined = true;
+    std::vector<Variable> bound_vars;
     std::for_each(_free_variables.begin()
                 , _free_variables.end()
-                , [&](std::string const& var_name)
+                , [&](util::symbol var_name)
                   {
-                      result.insert(std::make_pair(var_name, ext_st->queryVar(pos, var_name)));
+                      all_defined = all_defined && ext_st->isVarDefined(var_name);
+                      bound_vars.push_back(ext_st->queryVar(pos, var_name));
                   });
+    if (all_defined) {
+        _bound_vars.insert(std::make_pair(ext_st.id(), bound_vars));
+    }
+    return bound_vars;
+}
+
+std::map<util::symbol, Variable const> Function::_nameBoundVars(
+                                        std::vector<Variable> const& bound_vars) const
+{
+    std::map<util::symbol, Variable const> result;
+    for (unsigned i = 0; i < _free_variables.size(); ++i) {
+        result.insert(std::make_pair(_free_variables[i], bound_vars[i]));
+    }
     return result;
 }
 
+std::map<util::symbol, Variable const> Function::bindExternalVars(
+                                                  misc::position const& pos
+                                                , util::sref<SymbolTable const> ext_st)
+{
+    return _nameBoundVars(_boundVars(pos, ext_st));
+}
+
 util::sref<FuncReferenceType const> Function::refType(misc::position const& reference_pos
                                                     , util::sref<SymbolTable const> st)
 {
-    std::map<std::string, Variable const> ext_vars(bindExternalVars(reference_pos, st));
+    std::map<util::symbol, Variable const> ext_vars(bindExternalVars(reference_pos, st));
     auto find_result = std::find_if(_reference_types.begin()
                                   , _reference_types.end()
                                   , [&](util::sptr<FuncReferenceType const> const& type)
@@ -101,9 +149,13 @@ util::sref<FuncReferenceType const> Function::refType(misc::position const& refe
     return *_reference_types.back();
 }
 
-void Function::setFreeVariables(std::vector<std::string> const& free_vars)
+void Function::setFreeVariables(std::vector<util::symbol> const& free_vars)
 {
     _free_variables = free_vars;
+    std::sort(_free_variables.begin(), _free_variables.end());
+    _free_variables.erase(std::unique(_free_variables.begin(), _free_variables.end())
+                        , _free_variables.end());
+    _bound_vars.clear();
 }
 
 std::vector<util::sptr<inst::Function const>> Function::deliverFuncs()
@@ -116,36 +168,60 @@ util::sref<Block> Function::block()
     return util::mkref(_block);
 }
 
-Function::DraftCache::Iterator
-        Function::DraftCache::find(std::map<std::string, Variable const> const& ext_vars
-                                 , std::vector<util::sref<Type const>> const& arg_types) const
+static std::size_t hashCombine(std::size_t seed, std::size_t value)
+{
+    return seed ^ (value + 0x9e3779b9 + (seed << 6) + (seed >> 2));
+}
+
+bool Function::DraftKey::operator==(DraftKey const& rhs) const
+{
+    return ext_vars == rhs.ext_vars && arg_types == rhs.arg_types;
+}
+
+std::size_t Function::DraftKeyHash::operator()(DraftKey const& key) const
 {
-    return std::find_if(BaseType::begin()
-                      , BaseType::end()
-                      , [&](DraftInfo const& info)
-                        {
-                            return ext_vars == info.ext_vars && arg_types == info.arg_types;
-                        });
+    std::hash<Type const*> hash_type;
+    std::size_t seed = key.arg_types.size();
+    std::for_each(key.ext_vars.begin()
+                , key.ext_vars.end()
+                , [&](Variable const& var)
+                  {
+                      seed = hashCombine(seed, hash_type(var.type.operator->()));
+                      seed = hashCombine(seed, var.stack_offset);
+                      seed = hashCombine(seed, var.level);
+                  });
+    std::for_each(key.arg_types.begin()
+                , key.arg_types.end()
+                , [&](util::sref<Type const> type)
+                  {
+                      seed = hashCombine(seed, hash_type(type.operator->()));
+                  });
+    return seed;
 }
 
-Function::DraftCache::Iterator Function::DraftCache::end() const
+util::sref<FuncInstDraft> Function::DraftCache::findOrNul(DraftKey const& key) const
 {
-    return std::list<DraftInfo>::end();
+    auto find_result = _index.find(key);
+    if (_index.end() == find_result) {
+        return util::sref<FuncInstDraft>(nullptr);
+    }
+    return find_result->second;
 }
 
-void Function::DraftCache::append(DraftInfo info)
+void Function::DraftCache::append(DraftKey const& key, util::sptr<FuncInstDraft> draft)
 {
-    push_back(std::move(info));
+    _index.insert(std::make_pair(key, *draft));
+    _drafts.push_back(std::move(draft));
 }
 
 std::vector<util::sptr<inst::Function const>> Function::DraftCache::deliverFuncs()
 {
     std::vector<util::sptr<inst::Function const>> result;
-    std::for_each(BaseType::begin()
-                , BaseType::end()
-                , [&](DraftInfo& info)
+    std::for_each(_drafts.begin()
+                , _drafts.end()
+                , [&](util::sptr<FuncInstDraft>& draft)
                   {
-                      result.push_back(info.draft->deliver());
+                      result.push_back(draft->deliver());
                   });
     return std::move(result);
 }
@@ -2,15 +2,17 @@
 #define __STEKIN_PROTO_FUNCTION_H__
 
 #include <vector>
-#include <list>
 #include <map>
+#include <unordered_map>
 
 #include <misc/pos-type.h>
+#include <util/symbol.h>
 
 #include "fwd-decl.h"
 #include "block.h"
 #include "func-inst-draft.h"
 #include "func-reference-type.h"
+#include "variable.h"
 
 namespace proto {
 
@@ -19,13 +21,13 @@ namespace proto {
                                      , std::vector<util::sref<Type const>> const& arg_types
                                      , misc::trace& trace);
         util::sref<FuncInstDraft> inst(int level
-                                     , std::map<std::string, Variable const> const& ext_vars
+                                     , std::map<util::symbol, Variable const> const& ext_vars
                                      , std::vector<util::sref<Type const>> const& arg_types
                                      , misc::trace& trace);
 
         Function(misc::position const& ps
-               , std::string const& func_name
-               , std::vector<std::string> const& params
+               , util::symbol func_name
+               , std::vector<util::symbol> const& params
                , bool func_hint_void_return)
             : pos(ps)
             , name(func_name)
@@ -36,14 +38,14 @@ namespace proto {
         Function(Function const&) = delete;
 
         misc::position const pos;
-        std::string const name;
-        std::vector<std::string> const param_names;
+        util::symbol const name;
+        std::vector<util::symbol> const param_names;
         bool hint_void_return;
 
-        void setFreeVariables(std::vector<std::string> const& free_vars);
-        std::map<std::string, Variable const> bindExternalVars(
+        void setFreeVariables(std::vector<util::symbol> const& free_vars);
+        std::map<util::symbol, Variable const> bindExternalVars(
                                                 misc::position const& pos
-                                              , util::sref<SymbolTable const> ext_st) const;
+                                              , util::sref<SymbolTable const> ext_st);
 
         util::sref<FuncReferenceType const> refType(misc::position const& reference_pos
                                                   , util::sref<SymbolTable const> st);
@@ -51,51 +53,56 @@ namespace proto {
 
         util::sref<Block> block();
     private:
-        struct DraftInfo {
-            std::map<std::string, Variable const> const ext_vars;
+        /*
+         * Identifies an instantiation by the frame locations of the bound free
+         * variables, in the order of their names, and the argument types.
+         * Types are unique objects, so both compare and hash by address.
+         */
+        struct DraftKey {
+            std::vector<Variable> const ext_vars;
             std::vector<util::sref<Type const>> const arg_types;
-            util::sptr<FuncInstDraft> draft;
 
-            DraftInfo(std::map<std::string, Variable const> const& e
-                    , std::vector<util::sref<Type const>> const& a
-                    , util::sptr<FuncInstDraft> d)
+            DraftKey(std::vector<Variable> const& e
+                   , std::vector<util::sref<Type const>> const& a)
                 : ext_vars(e)
                 , arg_types(a)
-                , draft(std::move(d))
             {}
 
-            DraftInfo(DraftInfo&& rhs)
-                : ext_vars(rhs.ext_vars)
-                , arg_types(rhs.arg_types)
-                , draft(std::move(rhs.draft))
-            {}
+            bool operator==(DraftKey const& rhs) const;
+        };
+
+        struct DraftKeyHash {
+            std::size_t operator()(DraftKey const& key) const;
         };
 
-        struct DraftCache
-            : protected std::list<DraftInfo>
-        {
+        struct DraftCache {
             DraftCache() = default;
             ~DraftCache() = default;
 
-            typedef std::list<DraftInfo> BaseType;
-            typedef BaseType::const_iterator Iterator;
-
-            Iterator find(std::map<std::string, Variable const> const& ext_vars
-                        , std::vector<util::sref<Type const>> const& arg_types) const;
-            Iterator end() const;
-            void append(DraftInfo info);
+            util::sref<FuncInstDraft> findOrNul(DraftKey const& key) const;
+            void append(DraftKey const& key, util::sptr<FuncInstDraft> draft);
 
             std::vector<util::sptr<inst::Function const>> deliverFuncs();
+        private:
+            std::unordered_map<DraftKey, util::sref<FuncInstDraft>, DraftKeyHash> _index;
+            std::vector<util::sptr<FuncInstDraft>> _drafts;
         };
     private:
-        util::sref<FuncInstDraft> _draftInCacheOrNulIfNonexist(
-                                std::map<std::string, Variable const> const& ext_vars
-                              , std::vector<util::sref<Type const>> const& arg_types
-                              , misc::trace& trace) const;
+        std::vector<Variable> _boundVars(misc::position const& pos
+                                       , util::sref<SymbolTable const> ext_st);
+        std::map<util::symbol, Variable const> _nameBoundVars(
+                                        std::vector<Variable> const& bound_vars) const;
+        util::sref<FuncInstDraft> _draftInCacheOrNulIfNonexist(DraftKey const& key
+                                                             , misc::trace& trace) const;
+        util::sref<FuncInstDraft> _inst(int level
+                                      , DraftKey const& key
+                                      , std::map<util::symbol, Variable const> const& ext_vars
+                                      , misc::trace& trace);
     private:
         DraftCache _draft_cache;
         std::vector<util::sptr<FuncReferenceType const>> _reference_types;
-        std::vector<std::string> _free_variables;
+        std::vector<util::symbol> _free_variables;
+        std::map<util::id, std::vector<Variable>> _bound_vars;
         Block _block;
     };
 
@@ -2,6 +2,7 @@
 
 #include <instance/list-pipe.h>
 #include <report/errors.h>
+#include <misc/options.h>
 
 #include "list-pipe.h"
 #include "list-types.h"
@@ -13,6 +14,7 @@ util::sptr<inst::PipeBase const> PipeMap::inst(util::sref<SymbolTable const> st
                                              , misc::trace& trace) const
 {
     return util::mkptr(new inst::PipeMap(expr->instAsPipe(st, lc, trace)
+                                       , expr->usesListIndex()
                                        , lc->member_type->makeInstType()
                                        , typeTransfer(st, lc, trace)->makeInstType()));
 }
@@ -24,11 +26,33 @@ util::sref<Type const> PipeMap::typeTransfer(util::sref<SymbolTable const> st
     return expr->typeAsPipe(st, lc, trace);
 }
 
+bool PipeMap::indexBounds(util::sref<SymbolTable const>
+                        , misc::trace&
+                        , std::vector<util::sptr<inst::SliceBound const>>&) const
+{
+    return false;
+}
+
+util::sptr<inst::Expression const> PipeMap::instAsKernel(
+                                    util::sref<SymbolTable const> st
+                                  , util::sref<Type const> member_type
+                                  , std::vector<util::sptr<inst::Expression const>>& invariants
+                                  , misc::trace& trace) const
+{
+    return expr->instAsKernel(st, member_type, invariants, trace);
+}
+
+bool PipeMap::isElementwise(bool& index_renumbered) const
+{
+    return expr->isElementwise() && !(index_renumbered && expr->usesListIndex());
+}
+
 util::sptr<inst::PipeBase const> PipeFilter::inst(util::sref<SymbolTable const> st
                                                 , util::sref<ListContext const> lc
                                                 , misc::trace& trace) const
 {
     return util::mkptr(new inst::PipeFilter(expr->instAsPipe(st, lc, trace)
+                                          , expr->usesListIndex()
                                           , lc->member_type->makeInstType()));
 }
 
@@ -39,20 +63,133 @@ util::sref<Type const> PipeFilter::typeTransfer(util::sref<SymbolTable const>
     return lc->member_type;
 }
 
-static std::vector<util::sptr<inst::PipeBase const>> instPipeline(
-                                          std::vector<util::sptr<PipeBase const>> const& pipeline
+bool PipeFilter::indexBounds(util::sref<SymbolTable const> st
+                           , misc::trace& trace
+                           , std::vector<util::sptr<inst::SliceBound const>>& bounds) const
+{
+    return expr->indexBounds(st, trace, bounds);
+}
+
+util::sptr<inst::Expression const> PipeFilter::instAsKernel(
+                                    util::sref<SymbolTable const>
+                                  , util::sref<Type const>
+                                  , std::vector<util::sptr<inst::Expression const>>&
+                                  , misc::trace&) const
+{
+    return util::sptr<inst::Expression const>(nullptr);
+}
+
+bool PipeFilter::isElementwise(bool& index_renumbered) const
+{
+    bool elementwise = expr->isElementwise() && !(index_renumbered && expr->usesListIndex());
+    index_renumbered = true;
+    return elementwise;
+}
+
+static bool isPrimitive(util::sref<Type const> type)
+{
+    return Type::s_int() == type || Type::s_float() == type || Type::s_bool() == type;
+}
+
+/*
+ * Chunks of a pipeline run in parallel only if its stages are plain
+ * arithmetic and logic on primitive values, which neither share list buffers
+ * nor call functions that may write.  The index after a filter depends on the
+ * members passed in earlier chunks, so no stage after a filter may use it.
+ */
+static bool isParallel(std::vector<util::sptr<PipeBase const>>::const_iterator begin
+                     , std::vector<util::sptr<PipeBase const>>::const_iterator end
+                     , util::sref<SymbolTable const> st
+                     , util::sref<ListContext const> lc
+                     , misc::trace& trace)
+{
+    if (!misc::options::get().parallel_pipe || !isPrimitive(lc->member_type)) {
+        return false;
+    }
+    bool index_renumbered = false;
+    return std::all_of(begin
+                     , end
+                     , [&](util::sptr<PipeBase const> const& pipe)
+                       {
+                           return pipe->isElementwise(index_renumbered)
+                               && isPrimitive(pipe->typeTransfer(st, lc, trace));
+                       });
+}
+
+/*
+ * A pipeline of arithmetic maps over an int or float list, where every
+ * subexpression keeps the member type, is emitted as a vectorized kernel.
+ * Returns nul if any stage does not qualify.
+ */
+static util::sptr<inst::Expression const> instAsKernel(
+                                          util::sptr<inst::Expression const>& list
+                                        , std::vector<util::sptr<PipeBase const>>::const_iterator begin
+                                        , std::vector<util::sptr<PipeBase const>>::const_iterator end
+                                        , util::sref<SymbolTable const> st
+                                        , util::sref<ListContext const> lc
+                                        , misc::trace& trace)
+{
+    if (!misc::options::get().simd_kernel || begin == end
+            || !(Type::s_int() == lc->member_type || Type::s_float() == lc->member_type))
+    {
+        return util::sptr<inst::Expression const>(nullptr);
+    }
+    std::vector<util::sptr<inst::Expression const>> invariants;
+    std::vector<util::sptr<inst::Expression const>> maps;
+    bool uses_index = false;
+    for (; end != begin; ++begin) {
+        util::sptr<inst::Expression const> map(
+                (*begin)->instAsKernel(st, lc->member_type, invariants, trace));
+        if (map.nul()) {
+            return util::sptr<inst::Expression const>(nullptr);
+        }
+        maps.push_back(std::move(map));
+        uses_index = uses_index || (*begin)->expr->usesListIndex();
+    }
+    return util::mkptr(new inst::PipeKernel(std::move(list)
+                                          , lc->member_type->makeInstType()
+                                          , std::move(invariants)
+                                          , std::move(maps)
+                                          , uses_index
+                                          , misc::options::get().parallel_pipe));
+}
+
+/*
+ * Leading filters that keep a contiguous range of indices are turned into
+ * slices sharing the source buffer; the rest of the stages are fused as usual.
+ */
+static util::sptr<inst::Expression const> instPipeline(
+                                          util::sptr<inst::Expression const> list
+                                        , std::vector<util::sptr<PipeBase const>> const& pipeline
                                         , util::sref<SymbolTable const> st
                                         , util::sref<ListContext const> lc
                                         , misc::trace& trace)
 {
+    auto stage = pipeline.begin();
+    for (; pipeline.end() != stage; ++stage) {
+        std::vector<util::sptr<inst::SliceBound const>> bounds;
+        if (!(*stage)->indexBounds(st, trace, bounds)) {
+            break;
+        }
+        list = util::mkptr(new inst::ListSlice(std::move(list), std::move(bounds)));
+    }
+
+    util::sptr<inst::Expression const> kernel(
+                instAsKernel(list, stage, pipeline.end(), st, lc, trace));
+    if (kernel.not_nul()) {
+        return std::move(kernel);
+    }
+
     std::vector<util::sptr<inst::PipeBase const>> inst_pipe;
-    std::for_each(pipeline.begin()
+    std::for_each(stage
                 , pipeline.end()
                 , [&](util::sptr<PipeBase const> const& pipe)
                   {
                       inst_pipe.push_back(pipe->inst(st, lc, trace));
                   });
-    return std::move(inst_pipe);
+    return util::mkptr(new inst::ListPipeline(std::move(list)
+                                            , std::move(inst_pipe)
+                                            , isParallel(stage, pipeline.end(), st, lc, trace)));
 }
 
 static util::sref<Type const> typeTransfer(std::vector<util::sptr<PipeBase const>> const& pipeline
@@ -89,11 +226,10 @@ util::sptr<inst::Expression const> ListPipeline::inst(util::sref<SymbolTable con
     if (context.member_type.nul()) {
         error::pipeNotApplyOnList(pos);
         return util::mkptr(new inst::ListPipeline(list->inst(st, trace)
-                                                , std::vector<util::sptr<inst::PipeBase const>>()));
+                                                , std::vector<util::sptr<inst::PipeBase const>>()
+                                                , false));
     }
-    return util::mkptr(new inst::ListPipeline(
-                                        list->inst(st, trace)
-                                      , instPipeline(pipeline, st, util::mkref(context), trace)));
+    return instPipeline(list->inst(st, trace), pipeline, st, util::mkref(context), trace);
 }
 
 util::sref<Type const> ListPipeline::typeAsPipe(util::sref<SymbolTable const> st
@@ -117,9 +253,21 @@ util::sptr<inst::Expression const> ListPipeline::instAsPipe(util::sref<SymbolTab
     if (context.member_type.nul()) {
         error::pipeNotApplyOnList(pos);
         return util::mkptr(new inst::ListPipeline(list->instAsPipe(st, lc, trace)
-                                                , std::vector<util::sptr<inst::PipeBase const>>()));
+                                                , std::vector<util::sptr<inst::PipeBase const>>()
+                                                , false));
     }
-    return util::mkptr(new inst::ListPipeline(
-                                        list->instAsPipe(st, lc, trace)
-                                      , instPipeline(pipeline, st, util::mkref(context), trace)));
+    return instPipeline(list->instAsPipe(st, lc, trace)
+                      , pipeline
+                      , st
+                      , util::mkref(context)
+                      , trace);
+}
+
+/*
+ * Stages of a nested pipeline read its own index; only the source list is
+ * evaluated where the index of the enclosing pipeline is bound.
+ */
+bool ListPipeline::usesListIndex() const
+{
+    return list->usesListIndex();
 }
@@ -21,6 +21,15 @@ namespace proto {
         virtual util::sref<Type const> typeTransfer(util::sref<SymbolTable const> st
                                                   , util::sref<ListContext const> lc
                                                   , misc::trace& trace) const = 0;
+        virtual bool indexBounds(util::sref<SymbolTable const> st
+                               , misc::trace& trace
+                               , std::vector<util::sptr<inst::SliceBound const>>& bounds) const = 0;
+        virtual util::sptr<inst::Expression const> instAsKernel(
+                                    util::sref<SymbolTable const> st
+                                  , util::sref<Type const> member_type
+                                  , std::vector<util::sptr<inst::Expression const>>& invariants
+                                  , misc::trace& trace) const = 0;
+        virtual bool isElementwise(bool& index_renumbered) const = 0;
 
         util::sptr<Expression const> expr;
     };
@@ -38,6 +47,15 @@ namespace proto {
         util::sref<Type const> typeTransfer(util::sref<SymbolTable const> st
                                           , util::sref<ListContext const> lc
                                           , misc::trace& trace) const;
+        bool indexBounds(util::sref<SymbolTable const>
+                       , misc::trace&
+                       , std::vector<util::sptr<inst::SliceBound const>>&) const;
+        util::sptr<inst::Expression const> instAsKernel(
+                                    util::sref<SymbolTable const> st
+                                  , util::sref<Type const> member_type
+                                  , std::vector<util::sptr<inst::Expression const>>& invariants
+                                  , misc::trace& trace) const;
+        bool isElementwise(bool& index_renumbered) const;
     };
 
     struct PipeFilter
@@ -53,6 +71,15 @@ namespace proto {
         util::sref<Type const> typeTransfer(util::sref<SymbolTable const>
                                           , util::sref<ListContext const> lc
                                           , misc::trace&) const;
+        bool indexBounds(util::sref<SymbolTable const> st
+                       , misc::trace& trace
+                       , std::vector<util::sptr<inst::SliceBound const>>& bounds) const;
+        util::sptr<inst::Expression const> instAsKernel(
+                                    util::sref<SymbolTable const>
+                                  , util::sref<Type const>
+                                  , std::vector<util::sptr<inst::Expression const>>&
+                                  , misc::trace&) const;
+        bool isElementwise(bool& index_renumbered) const;
     };
 
     struct ListPipeline
@@ -75,6 +102,7 @@ namespace proto {
         util::sptr<inst::Expression const> instAsPipe(util::sref<SymbolTable const> st
                                                     , util::sref<ListContext const> lc
                                                     , misc::trace& trace) const;
+        bool usesListIndex() const;
 
         util::sptr<Expression const> const list;
         std::vector<util::sptr<PipeBase const>> const pipeline;
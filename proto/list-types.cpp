@@ -151,7 +151,20 @@ util::sref<Type const> ListType::memberCallType(std::string const& call_name
     return bad();
 }
 
+static int inlineSize(util::sref<Type const> member_type)
+{
+    if (Type::s_int() == member_type
+            || Type::s_float() == member_type
+            || Type::s_bool() == member_type)
+    {
+        return platform::LIST_INLINE_SIZE;
+    }
+    return 0;
+}
+
 ListType::ListType(util::sref<Type const> mt)
-    : Type(platform::WORD_LENGTH_INBYTE + platform::INT_SIZE + platform::VIRTUAL_FUNC_TABLE_SIZE)
+    : Type(platform::WORD_LENGTH_INBYTE * 2
+         + platform::INT_SIZE
+         + inlineSize(mt))
     , member_type(mt)
 {}
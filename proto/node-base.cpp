@@ -1,6 +1,8 @@
 #include <instance/node-base.h>
+#include <instance/list-pipe.h>
 
 #include "node-base.h"
+#include "type.h"
 
 using namespace proto;
 
@@ -17,3 +19,48 @@ util::sptr<inst::Expression const> Expression::instAsPipe(util::sref<SymbolTable
 {
     return inst(st, trace);
 }
+
+bool Expression::isListIndex() const
+{
+    return false;
+}
+
+bool Expression::isPipeInvariant() const
+{
+    return false;
+}
+
+bool Expression::mayTrap() const
+{
+    return false;
+}
+
+bool Expression::isElementwise() const
+{
+    return false;
+}
+
+bool Expression::usesListIndex() const
+{
+    return false;
+}
+
+bool Expression::indexBounds(util::sref<SymbolTable const>
+                           , misc::trace&
+                           , std::vector<util::sptr<inst::SliceBound const>>&) const
+{
+    return false;
+}
+
+util::sptr<inst::Expression const> Expression::instAsKernel(
+                                    util::sref<SymbolTable const> st
+                                  , util::sref<Type const> member_type
+                                  , std::vector<util::sptr<inst::Expression const>>& invariants
+                                  , misc::trace& trace) const
+{
+    if (!isPipeInvariant() || member_type != type(st, trace)) {
+        return util::sptr<inst::Expression const>(nullptr);
+    }
+    invariants.push_back(inst(st, trace));
+    return util::mkptr(new inst::KernelInvariant(invariants.size() - 1));
+}
@@ -4,6 +4,7 @@
 #include <vector>
 
 #include <instance/fwd-decl.h>
+#include <util/arena.h>
 #include <util/pointer.h>
 #include <misc/pos-type.h>
 
@@ -11,7 +12,12 @@
 
 namespace proto {
 
-    struct Expression {
+    struct NodeArenaTag;
+    typedef util::arena_allocated<NodeArenaTag> ArenaNode;
+
+    struct Expression
+        : public ArenaNode
+    {
         virtual ~Expression() {}
 
         virtual util::sref<Type const> type(util::sref<SymbolTable const> st
@@ -25,6 +31,20 @@ namespace proto {
                                                             , util::sref<ListContext const> lc
                                                             , misc::trace& trace) const;
 
+        virtual bool isListIndex() const;
+        virtual bool isPipeInvariant() const;
+        virtual bool mayTrap() const;
+        virtual bool isElementwise() const;
+        virtual bool usesListIndex() const;
+        virtual bool indexBounds(util::sref<SymbolTable const> st
+                               , misc::trace& trace
+                               , std::vector<util::sptr<inst::SliceBound const>>& bounds) const;
+        virtual util::sptr<inst::Expression const> instAsKernel(
+                                    util::sref<SymbolTable const> st
+                                  , util::sref<Type const> member_type
+                                  , std::vector<util::sptr<inst::Expression const>>& invariants
+                                  , misc::trace& trace) const;
+
         misc::position const pos;
     protected:
         explicit Expression(misc::position const ps)
@@ -32,7 +52,9 @@ namespace proto {
         {}
     };
 
-    struct Statement {
+    struct Statement
+        : public ArenaNode
+    {
         virtual ~Statement() {}
 
         virtual void addTo(util::sref<FuncInstDraft> func) = 0;
@@ -1,4 +1,5 @@
 #include <map>
+#include <vector>
 
 #include <report/errors.h>
 
@@ -45,7 +46,58 @@ static Operation const BAD_OPERATION(Type::bad(), "");
 
 namespace {
 
-    struct BadOpException {};
+    std::string const BINARY_OPS[] = { "+", "-", "*", "/", "%", "=", "!=", "<=", "<", ">=", ">" };
+    int const BINARY_OP_COUNT = sizeof(BINARY_OPS) / sizeof(BINARY_OPS[0]);
+
+    std::string const PRE_UNARY_OPS[] = { "+", "-" };
+    int const PRE_UNARY_OP_COUNT = sizeof(PRE_UNARY_OPS) / sizeof(PRE_UNARY_OPS[0]);
+
+    /*
+     * Operators that have operations take the first ids, in the order listed
+     * above; any other operator is given the next free id and matches none.
+     */
+    struct OpIds {
+        OpIds(std::string const* ops, int count)
+            : imgs(ops, ops + count)
+        {
+            for (int i = 0; i < count; ++i) {
+                _ids.insert(std::make_pair(imgs[i], i));
+            }
+        }
+
+        int intern(std::string const& op)
+        {
+            auto find_result = _ids.find(op);
+            if (_ids.end() != find_result) {
+                return find_result->second;
+            }
+            int id = imgs.size();
+            _ids.insert(std::make_pair(op, id));
+            imgs.push_back(op);
+            return id;
+        }
+
+        std::vector<std::string> imgs;
+    private:
+        std::map<std::string, int> _ids;
+    };
+
+    OpIds& binaryOpIds()
+    {
+        static OpIds ids(BINARY_OPS, BINARY_OP_COUNT);
+        return ids;
+    }
+
+    OpIds& preUnaryOpIds()
+    {
+        static OpIds ids(PRE_UNARY_OPS, PRE_UNARY_OP_COUNT);
+        return ids;
+    }
+
+    bool isPrimitive(util::sref<Type const> type)
+    {
+        return Type::NOT_PRIMITIVE != type->primitive_index;
+    }
 
     struct BinaryOpMap {
         static BinaryOpMap const& instance()
@@ -54,102 +106,88 @@ namespace {
             return inst;
         }
 
-        util::sref<Operation const> query(std::string const& op
-                                        , util::sref<Type const> lhs
-                                        , util::sref<Type const> rhs) const
+        util::sref<Operation const> queryOrNul(int op_id
+                                             , util::sref<Type const> lhs
+                                             , util::sref<Type const> rhs) const
         {
             if (Type::bad() == lhs || Type::bad() == rhs) {
                 return util::mkref(BAD_OPERATION);
             }
-
-            auto first_stage = _map.find(op);
-            if (_map.end() == first_stage) {
-                throw BadOpException();
-            }
-
-            auto second_stage = first_stage->second.find(lhs);
-            if (first_stage->second.end() == second_stage) {
-                throw BadOpException();
-            }
-
-            auto third_stage = second_stage->second.find(rhs);
-            if (second_stage->second.end() == third_stage) {
-                throw BadOpException();
+            if (BINARY_OP_COUNT <= op_id || !isPrimitive(lhs) || !isPrimitive(rhs)) {
+                return util::sref<Operation const>(nullptr);
             }
-
-            return third_stage->second;
+            return util::sref<Operation const>(
+                        _table[op_id][lhs->primitive_index][rhs->primitive_index]);
         }
     private:
-        BinaryOpMap& _add(std::string const& op_id
+        BinaryOpMap& _add(std::string const& op
                         , util::sref<Type const> lhs
                         , util::sref<Type const> rhs
-                        , util::sref<Operation const> oper)
+                        , Operation const& oper)
         {
-            _map[op_id][lhs].insert(std::make_pair(rhs, oper));
+            _table[binaryOpIds().intern(op)][lhs->primitive_index][rhs->primitive_index] = &oper;
             return *this;
         }
     private:
         BinaryOpMap()
+            : _table()
         {
             (*this)
-                ._add("+", Type::s_int(), Type::s_int(), util::mkref(BIT_INT_ADD))
-                ._add("-", Type::s_int(), Type::s_int(), util::mkref(BIT_INT_SUB))
-                ._add("*", Type::s_int(), Type::s_int(), util::mkref(BIT_INT_MUL))
-                ._add("/", Type::s_int(), Type::s_int(), util::mkref(BIT_INT_DIV))
-                ._add("%", Type::s_int(), Type::s_int(), util::mkref(BIT_INT_MOD))
-
-                ._add("+", Type::s_float(), Type::s_float(), util::mkref(BIT_FLOAT_ADD))
-                ._add("-", Type::s_float(), Type::s_float(), util::mkref(BIT_FLOAT_SUB))
-                ._add("*", Type::s_float(), Type::s_float(), util::mkref(BIT_FLOAT_MUL))
-                ._add("/", Type::s_float(), Type::s_float(), util::mkref(BIT_FLOAT_DIV))
-
-                ._add("=", Type::s_bool(), Type::s_bool(), util::mkref(BIT_BOOL_EQ))
-                ._add("!=", Type::s_bool(), Type::s_bool(), util::mkref(BIT_BOOL_NE))
-
-                ._add("+", Type::s_int(), Type::s_float(), util::mkref(BIT_FLOAT_ADD))
-                ._add("-", Type::s_int(), Type::s_float(), util::mkref(BIT_FLOAT_SUB))
-                ._add("*", Type::s_int(), Type::s_float(), util::mkref(BIT_FLOAT_MUL))
-                ._add("/", Type::s_int(), Type::s_float(), util::mkref(BIT_FLOAT_DIV))
-
-                ._add("+", Type::s_float(), Type::s_int(), util::mkref(BIT_FLOAT_ADD))
-                ._add("-", Type::s_float(), Type::s_int(), util::mkref(BIT_FLOAT_SUB))
-                ._add("*", Type::s_float(), Type::s_int(), util::mkref(BIT_FLOAT_MUL))
-                ._add("/", Type::s_float(), Type::s_int(), util::mkref(BIT_FLOAT_DIV))
-
-                ._add("=", Type::s_int(), Type::s_int(), util::mkref(BIT_INT_EQ))
-                ._add("<=", Type::s_int(), Type::s_int(), util::mkref(BIT_INT_LE))
-                ._add("<", Type::s_int(), Type::s_int(), util::mkref(BIT_INT_LT))
-                ._add(">=", Type::s_int(), Type::s_int(), util::mkref(BIT_INT_GE))
-                ._add(">", Type::s_int(), Type::s_int(), util::mkref(BIT_INT_GT))
-                ._add("!=", Type::s_int(), Type::s_int(), util::mkref(BIT_INT_NE))
-
-                ._add("=", Type::s_float(), Type::s_float(), util::mkref(BIT_FLOAT_EQ))
-                ._add("<=", Type::s_float(), Type::s_float(), util::mkref(BIT_FLOAT_LE))
-                ._add("<", Type::s_float(), Type::s_float(), util::mkref(BIT_FLOAT_LT))
-                ._add(">=", Type::s_float(), Type::s_float(), util::mkref(BIT_FLOAT_GE))
-                ._add(">", Type::s_float(), Type::s_float(), util::mkref(BIT_FLOAT_GT))
-                ._add("!=", Type::s_float(), Type::s_float(), util::mkref(BIT_FLOAT_NE))
-
-                ._add("=", Type::s_int(), Type::s_float(), util::mkref(BIT_FLOAT_EQ))
-                ._add("<=", Type::s_int(), Type::s_float(), util::mkref(BIT_FLOAT_LE))
-                ._add("<", Type::s_int(), Type::s_float(), util::mkref(BIT_FLOAT_LT))
-                ._add(">=", Type::s_int(), Type::s_float(), util::mkref(BIT_FLOAT_GE))
-                ._add(">", Type::s_int(), Type::s_float(), util::mkref(BIT_FLOAT_GT))
-                ._add("!=", Type::s_int(), Type::s_float(), util::mkref(BIT_FLOAT_NE))
-
-                ._add("=", Type::s_float(), Type::s_int(), util::mkref(BIT_FLOAT_EQ))
-                ._add("<=", Type::s_float(), Type::s_int(), util::mkref(BIT_FLOAT_LE))
-                ._add("<", Type::s_float(), Type::s_int(), util::mkref(BIT_FLOAT_LT))
-                ._add(">=", Type::s_float(), Type::s_int(), util::mkref(BIT_FLOAT_GE))
-                ._add(">", Type::s_float(), Type::s_int(), util::mkref(BIT_FLOAT_GT))
-                ._add("!=", Type::s_float(), Type::s_int(), util::mkref(BIT_FLOAT_NE))
+                ._add("+", Type::s_int(), Type::s_int(), BIT_INT_ADD)
+                ._add("-", Type::s_int(), Type::s_int(), BIT_INT_SUB)
+                ._add("*", Type::s_int(), Type::s_int(), BIT_INT_MUL)
+                ._add("/", Type::s_int(), Type::s_int(), BIT_INT_DIV)
+                ._add("%", Type::s_int(), Type::s_int(), BIT_INT_MOD)
+
+                ._add("+", Type::s_float(), Type::s_float(), BIT_FLOAT_ADD)
+                ._add("-", Type::s_float(), Type::s_float(), BIT_FLOAT_SUB)
+                ._add("*", Type::s_float(), Type::s_float(), BIT_FLOAT_MUL)
+                ._add("/", Type::s_float(), Type::s_float(), BIT_FLOAT_DIV)
+
+                ._add("=", Type::s_bool(), Type::s_bool(), BIT_BOOL_EQ)
+                ._add("!=", Type::s_bool(), Type::s_bool(), BIT_BOOL_NE)
+
+                ._add("+", Type::s_int(), Type::s_float(), BIT_FLOAT_ADD)
+                ._add("-", Type::s_int(), Type::s_float(), BIT_FLOAT_SUB)
+                ._add("*", Type::s_int(), Type::s_float(), BIT_FLOAT_MUL)
+                ._add("/", Type::s_int(), Type::s_float(), BIT_FLOAT_DIV)
+
+                ._add("+", Type::s_float(), Type::s_int(), BIT_FLOAT_ADD)
+                ._add("-", Type::s_float(), Type::s_int(), BIT_FLOAT_SUB)
+                ._add("*", Type::s_float(), Type::s_int(), BIT_FLOAT_MUL)
+                ._add("/", Type::s_float(), Type::s_int(), BIT_FLOAT_DIV)
+
+                ._add("=", Type::s_int(), Type::s_int(), BIT_INT_EQ)
+                ._add("<=", Type::s_int(), Type::s_int(), BIT_INT_LE)
+                ._add("<", Type::s_int(), Type::s_int(), BIT_INT_LT)
+                ._add(">=", Type::s_int(), Type::s_int(), BIT_INT_GE)
+                ._add(">", Type::s_int(), Type::s_int(), BIT_INT_GT)
+                ._add("!=", Type::s_int(), Type::s_int(), BIT_INT_NE)
+
+                ._add("=", Type::s_float(), Type::s_float(), BIT_FLOAT_EQ)
+                ._add("<=", Type::s_float(), Type::s_float(), BIT_FLOAT_LE)
+                ._add("<", Type::s_float(), Type::s_float(), BIT_FLOAT_LT)
+                ._add(">=", Type::s_float(), Type::s_float(), BIT_FLOAT_GE)
+                ._add(">", Type::s_float(), Type::s_float(), BIT_FLOAT_GT)
+                ._add("!=", Type::s_float(), Type::s_float(), BIT_FLOAT_NE)
+
+                ._add("=", Type::s_int(), Type::s_float(), BIT_FLOAT_EQ)
+                ._add("<=", Type::s_int(), Type::s_float(), BIT_FLOAT_LE)
+                ._add("<", Type::s_int(), Type::s_float(), BIT_FLOAT_LT)
+                ._add(">=", Type::s_int(), Type::s_float(), BIT_FLOAT_GE)
+                ._add(">", Type::s_int(), Type::s_float(), BIT_FLOAT_GT)
+                ._add("!=", Type::s_int(), Type::s_float(), BIT_FLOAT_NE)
+
+                ._add("=", Type::s_float(), Type::s_int(), BIT_FLOAT_EQ)
+                ._add("<=", Type::s_float(), Type::s_int(), BIT_FLOAT_LE)
+                ._add("<", Type::s_float(), Type::s_int(), BIT_FLOAT_LT)
+                ._add(">=", Type::s_float(), Type::s_int(), BIT_FLOAT_GE)
+                ._add(">", Type::s_float(), Type::s_int(), BIT_FLOAT_GT)
+                ._add("!=", Type::s_float(), Type::s_int(), BIT_FLOAT_NE)
             ;
         }
 
-        std::map<std::string
-               , std::map<util::sref<Type const>
-                        , std::map<util::sref<Type const>
-                                 , util::sref<Operation const>>>> _map;
+        Operation const* _table[BINARY_OP_COUNT][Type::PRIMITIVE_COUNT][Type::PRIMITIVE_COUNT];
     };
 
     struct PreUnaryOpMap {
@@ -159,70 +197,88 @@ namespace {
             return inst;
         }
 
-        util::sref<Operation const> query(std::string const& op, util::sref<Type const> rhs) const
+        util::sref<Operation const> queryOrNul(int op_id, util::sref<Type const> rhs) const
         {
             if (Type::bad() == rhs) {
                 return util::mkref(BAD_OPERATION);
             }
-
-            auto first_stage = _map.find(op);
-            if (_map.end() == first_stage) {
-                throw BadOpException();
+            if (PRE_UNARY_OP_COUNT <= op_id || !isPrimitive(rhs)) {
+                return util::sref<Operation const>(nullptr);
             }
-
-            auto second_stage = first_stage->second.find(rhs);
-            if (first_stage->second.end() == second_stage) {
-                throw BadOpException();
-            }
-
-            return second_stage->second;
+            return util::sref<Operation const>(_table[op_id][rhs->primitive_index]);
         }
     private:
-        PreUnaryOpMap& _add(std::string const& op_id
+        PreUnaryOpMap& _add(std::string const& op
                           , util::sref<Type const> rhs
-                          , util::sref<Operation const> oper)
+                          , Operation const& oper)
         {
-            _map[op_id].insert(std::make_pair(rhs, oper));
+            _table[preUnaryOpIds().intern(op)][rhs->primitive_index] = &oper;
             return *this;
         }
     private:
         PreUnaryOpMap()
+            : _table()
         {
             (*this)
-                ._add("+", Type::s_int(), util::mkref(BIT_POSI_INT))
-                ._add("-", Type::s_int(), util::mkref(BIT_NEGA_INT))
+                ._add("+", Type::s_int(), BIT_POSI_INT)
+                ._add("-", Type::s_int(), BIT_NEGA_INT)
 
-                ._add("+", Type::s_float(), util::mkref(BIT_POSI_FLOAT))
-                ._add("-", Type::s_float(), util::mkref(BIT_NEGA_FLOAT))
+                ._add("+", Type::s_float(), BIT_POSI_FLOAT)
+                ._add("-", Type::s_float(), BIT_NEGA_FLOAT)
             ;
         }
 
-        std::map<std::string, std::map<util::sref<Type const>, util::sref<Operation const>>> _map;
+        Operation const* _table[PRE_UNARY_OP_COUNT][Type::PRIMITIVE_COUNT];
     };
 
 }
 
+int Operation::binaryOpId(std::string const& op)
+{
+    return binaryOpIds().intern(op);
+}
+
+int Operation::preUnaryOpId(std::string const& op)
+{
+    return preUnaryOpIds().intern(op);
+}
+
 util::sref<Operation const> Operation::queryBinary(misc::position const& pos
-                                                 , std::string const& op
+                                                 , int op_id
                                                  , util::sref<Type const> lhs
                                                  , util::sref<Type const> rhs)
 {
-    try {
-        return BinaryOpMap::instance().query(op, lhs, rhs);
-    } catch (BadOpException) {
-        error::binaryOpNotAvai(pos, op, lhs->name(), rhs->name());
+    util::sref<Operation const> oper(BinaryOpMap::instance().queryOrNul(op_id, lhs, rhs));
+    if (oper.nul()) {
+        error::binaryOpNotAvai(pos, binaryOpIds().imgs[op_id], lhs->name(), rhs->name());
         return util::mkref(BAD_OPERATION);
     }
+    return oper;
 }
 
 util::sref<Operation const> Operation::queryPreUnary(misc::position const& pos
-                                                   , std::string const& op
+                                                   , int op_id
                                                    , util::sref<Type const> rhs)
 {
-    try {
-        return PreUnaryOpMap::instance().query(op, rhs);
-    } catch (BadOpException) {
-        error::preUnaryOpNotAvai(pos, op, rhs->name());
+    util::sref<Operation const> oper(PreUnaryOpMap::instance().queryOrNul(op_id, rhs));
+    if (oper.nul()) {
+        error::preUnaryOpNotAvai(pos, preUnaryOpIds().imgs[op_id], rhs->name());
         return util::mkref(BAD_OPERATION);
     }
+    return oper;
+}
+
+util::sref<Operation const> Operation::queryBinary(misc::position const& pos
+                                                 , std::string const& op
+                                                 , util::sref<Type const> lhs
+                                                 , util::sref<Type const> rhs)
+{
+    return queryBinary(pos, binaryOpId(op), lhs, rhs);
+}
+
+util::sref<Operation const> Operation::queryPreUnary(misc::position const& pos
+                                                   , std::string const& op
+                                                   , util::sref<Type const> rhs)
+{
+    return queryPreUnary(pos, preUnaryOpId(op), rhs);
 }
@@ -19,6 +19,21 @@ namespace proto {
             , op_img(oi)
         {}
 
+        /*
+         * Operators are interned to dense ids when expressions are built, so
+         * queries index a table instead of looking up operator strings.
+         */
+        static int binaryOpId(std::string const& op);
+        static int preUnaryOpId(std::string const& op);
+
+        static util::sref<Operation const> queryBinary(misc::position const& pos
+                                                     , int op_id
+                                                     , util::sref<Type const> lhs
+                                                     , util::sref<Type const> rhs);
+        static util::sref<Operation const> queryPreUnary(misc::position const& pos
+                                                       , int op_id
+                                                       , util::sref<Type const> rhs);
+
         static util::sref<Operation const> queryBinary(misc::position const& pos
                                                      , std::string const& op
                                                      , util::sref<Type const> lhs
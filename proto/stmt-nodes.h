@@ -1,6 +1,8 @@
 #ifndef __STEKIN_PROTO_STATEMENT_NODES_H__
 #define __STEKIN_PROTO_STATEMENT_NODES_H__
 
+#include <util/symbol.h>
+
 #include "node-base.h"
 
 namespace proto {
@@ -68,13 +70,13 @@ namespace proto {
     struct VarDef
         : public DirectInst
     {
-        VarDef(misc::position const& pos, std::string const& n, util::sptr<Expression const> i)
+        VarDef(misc::position const& pos, util::symbol n, util::sptr<Expression const> i)
             : DirectInst(pos)
             , name(n)
             , init(std::move(i))
         {}
 
-        std::string const name;
+        util::symbol const name;
         util::sptr<Expression const> const init;
     protected:
         util::sptr<inst::Statement const> _inst(util::sref<FuncInstDraft> func
@@ -14,10 +14,10 @@ static Variable const BAD_REF(misc::position(), Type::s_void(), 0, 0);
 
 SymbolTable::SymbolTable(int ext_lvl
                        , std::list<ArgNameTypeRec> const& args
-                       , std::map<std::string, Variable const> const& ext_vars)
+                       , std::map<util::symbol, Variable const> const& ext_vars)
     : level(ext_lvl + 1)
     , _ss_used(0)
-    , _external_defs(ext_vars)
+    , _external_defs(ext_vars.begin(), ext_vars.end())
 {
     std::for_each(args.begin()
                 , args.end()
@@ -51,7 +51,7 @@ static void mergeResEntries(std::vector<int>& a, std::vector<int> b)
 
 Variable SymbolTable::defVar(misc::position const& pos
                            , util::sref<Type const> var_type
-                           , std::string const& name)
+                           , util::symbol name)
 {
     int offset = calcOffsetOnAlign(_ss_used, var_type->size);
     auto insert_result = _local_defs.insert(
@@ -61,7 +61,7 @@ Variable SymbolTable::defVar(misc::position const& pos
     return insert_result.first->second;
 }
 
-Variable SymbolTable::queryVar(misc::position const& pos, std::string const& name) const
+Variable SymbolTable::queryVar(misc::position const& pos, util::symbol name) const
 {
     auto find_result = _local_defs.find(name);
     if (_local_defs.end() != find_result) {
@@ -73,23 +73,29 @@ Variable SymbolTable::queryVar(misc::position const& pos, std::string const& nam
         return ext_find_result->second;
     }
 
-    error::varNotDef(pos, name);
+    error::varNotDef(pos, name.str());
     return BAD_REF;
 }
 
+bool SymbolTable::isVarDefined(util::symbol name) const
+{
+    return _local_defs.end() != _local_defs.find(name)
+        || _external_defs.end() != _external_defs.find(name);
+}
+
 util::sref<Operation const> SymbolTable::queryBinary(misc::position const& pos
-                                                   , std::string const& op
+                                                   , int op_id
                                                    , util::sref<Type const> lhs
                                                    , util::sref<Type const> rhs) const
 {
-    return Operation::queryBinary(pos, op, lhs, rhs);
+    return Operation::queryBinary(pos, op_id, lhs, rhs);
 }
 
 util::sref<Operation const> SymbolTable::queryPreUnary(misc::position const& pos
-                                                     , std::string const& op
+                                                     , int op_id
                                                      , util::sref<Type const> rhs) const
 {
-    return Operation::queryPreUnary(pos, op, rhs);
+    return Operation::queryPreUnary(pos, op_id, rhs);
 }
 
 int SymbolTable::stackSize() const
@@ -102,6 +108,22 @@ std::list<Variable> SymbolTable::getArgs() const
     return _args;
 }
 
+std::list<Variable> SymbolTable::getLocals() const
+{
+    std::list<Variable> locals;
+    std::for_each(_local_defs.begin()
+                , _local_defs.end()
+                , [&](std::pair<util::symbol const, Variable const> const& def)
+                  {
+                      locals.push_back(def.second);
+                  });
+    locals.sort([&](Variable const& a, Variable const& b)
+                {
+                    return a.stack_offset < b.stack_offset;
+                });
+    return locals;
+}
+
 std::vector<int> SymbolTable::getResEntries() const
 {
     return _res_entries;
@@ -3,20 +3,22 @@
 
 #include <string>
 #include <map>
+#include <unordered_map>
 #include <list>
 
 #include <misc/pos-type.h>
 #include <util/pointer.h>
+#include <util/symbol.h>
 
 #include "fwd-decl.h"
 
 namespace proto {
 
     struct ArgNameTypeRec {
-        std::string const name;
+        util::symbol const name;
         util::sref<Type const> const atype;
 
-        ArgNameTypeRec(std::string const& n, util::sref<Type const> const t)
+        ArgNameTypeRec(util::symbol n, util::sref<Type const> const t)
             : name(n)
             , atype(t)
         {}
@@ -25,7 +27,7 @@ namespace proto {
     struct SymbolTable {
         SymbolTable(int ext_lvl
                   , std::list<ArgNameTypeRec> const& args
-                  , std::map<std::string, Variable const> const& ext_vars);
+                  , std::map<util::symbol, Variable const> const& ext_vars);
 
         SymbolTable()
             : level(0)
@@ -34,28 +36,30 @@ namespace proto {
     public:
         Variable defVar(misc::position const& pos
                       , util::sref<Type const> type
-                      , std::string const& name);
-        Variable queryVar(misc::position const& pos, std::string const& name) const;
+                      , util::symbol name);
+        Variable queryVar(misc::position const& pos, util::symbol name) const;
+        bool isVarDefined(util::symbol name) const;
 
         util::sref<Operation const> queryBinary(misc::position const& pos
-                                              , std::string const& op
+                                              , int op_id
                                               , util::sref<Type const> lhs
                                               , util::sref<Type const> rhs) const;
         util::sref<Operation const> queryPreUnary(misc::position const& pos
-                                                , std::string const& op
+                                                , int op_id
                                                 , util::sref<Type const> rhs) const;
     public:
         int const level;
     public:
         int stackSize() const;
         std::list<Variable> getArgs() const;
+        std::list<Variable> getLocals() const; /* ordered by offset */
         std::vector<int> getResEntries() const;
     private:
         int _ss_used;
         std::list<Variable> _args;
         std::vector<int> _res_entries;
-        std::map<std::string, Variable const> _local_defs;
-        std::map<std::string, Variable const> const _external_defs;
+        std::unordered_map<util::symbol, Variable const> _local_defs;
+        std::unordered_map<util::symbol, Variable const> const _external_defs;
 
         SymbolTable(SymbolTable const&) = delete;
     };
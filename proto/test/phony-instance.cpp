@@ -98,6 +98,43 @@ void ListLiteral::write() const
     DataTree::actualOne()(LIST_END);
 }
 
+void StaticListBase::write() const
+{
+    DataTree::actualOne()(STATIC_LIST_BEGIN);
+    writeDef();
+    DataTree::actualOne()(LIST_END);
+}
+
+static void writeStaticMember(platform::int_type value)
+{
+    DataTree::actualOne()(INTEGER, util::str(value));
+}
+
+static void writeStaticMember(platform::float_type value)
+{
+    DataTree::actualOne()(FLOATING, util::str(value));
+}
+
+static void writeStaticMember(bool value)
+{
+    DataTree::actualOne()(BOOLEAN, util::str(value));
+}
+
+template <typename _Value>
+void StaticListLiteral<_Value>::writeDef() const
+{
+    std::for_each(value.begin()
+                , value.end()
+                , [&](_Value const& member)
+                  {
+                      writeStaticMember(member);
+                  });
+}
+
+template struct inst::StaticListLiteral<platform::int_type>;
+template struct inst::StaticListLiteral<platform::float_type>;
+template struct inst::StaticListLiteral<bool>;
+
 void ListElement::write() const
 {
     DataTree::actualOne()(LIST_ELEMENT);
@@ -178,24 +215,51 @@ void MemberCall::write() const
 
 void ListPipeline::write() const
 {
-    DataTree::actualOne()(LIST_PIPELINE, util::str(int(pipeline.size())));
+    DataTree::actualOne()(parallel ? PARALLEL_PIPELINE : LIST_PIPELINE
+                        , util::str(int(pipeline.size())));
     list->write();
     std::for_each(pipeline.begin()
                 , pipeline.end()
                 , [&](util::sptr<PipeBase const> const& pipe)
                   {
-                      pipe->begin();
+                      pipe->writeStageBegin(pipe->uses_index);
                   });
 }
 
-void PipeMap::begin() const
+void ListSlice::write() const
 {
-    DataTree::actualOne()(PIPE_MAP);
+    DataTree::actualOne()(LIST_SLICE, util::str(int(bounds.size())));
+    list->write();
+    std::for_each(bounds.begin()
+                , bounds.end()
+                , [&](util::sptr<SliceBound const> const& bound)
+                  {
+                      DataTree::actualOne()(SLICE_BOUND, bound->op);
+                      bound->bound->write();
+                  });
 }
 
-void PipeFilter::begin() const
+void KernelInvariant::write() const
 {
-    DataTree::actualOne()(PIPE_FILTER);
+    DataTree::actualOne()(KERNEL_INVARIANT, util::str(index));
+}
+
+void PipeKernel::write() const
+{
+    DataTree::actualOne()(PIPE_KERNEL, util::str(int(invariants.size())), maps.size());
+    list->write();
+    writeList(invariants);
+    writeList(maps);
+}
+
+void PipeMap::writeStageBegin(bool index_read) const
+{
+    DataTree::actualOne()(PIPE_MAP, util::str(int(index_read)));
+}
+
+void PipeFilter::writeStageBegin(bool index_read) const
+{
+    DataTree::actualOne()(PIPE_FILTER, util::str(int(index_read)));
 }
 
 void Function::writeDecl() const
@@ -244,17 +308,39 @@ std::string EmptyListType::exportedName() const
     return "";
 }
 
-void Type::writeResEntry(int) const {}
-void ListType::writeResEntry(int) const {}
-
 util::sptr<output::StackVarRec const> Type::makeParameter(Address const&) const
 {
     return util::sptr<output::StackVarRec const>(nullptr);
 }
 
-util::sptr<output::StackVarRec const> ListType::makeParameter(Address const&) const
+bool Type::isResource() const
 {
-    return util::sptr<output::StackVarRec const>(nullptr);
+    return false;
+}
+
+bool ListType::isResource() const
+{
+    return true;
+}
+
+bool Type::isScalar() const
+{
+    return false;
+}
+
+bool IntPrimitive::isScalar() const
+{
+    return true;
+}
+
+bool FloatPrimitive::isScalar() const
+{
+    return true;
+}
+
+bool BoolPrimitive::isScalar() const
+{
+    return true;
 }
 
 void Expression::writePipeDef(int) const {}
@@ -268,7 +354,58 @@ void Conjunction::writePipeDef(int) const {}
 void Disjunction::writePipeDef(int) const {}
 void Negation::writePipeDef(int) const {}
 void ListPipeline::writePipeDef(int) const {}
-void PipeMap::end() const {}
-void PipeFilter::end() const {}
-void PipeMap::writeDef(int) const {}
-void PipeFilter::writeDef(int) const {}
+void ListSlice::writePipeDef(int) const {}
+void PipeKernel::writePipeDef(int) const {}
+std::string PipeMap::srcMemberTypeName() const { return ""; }
+std::string PipeMap::dstMemberTypeName() const { return ""; }
+bool PipeMap::renumbersIndex() const { return false; }
+void PipeMap::writeCounter(bool) const {}
+void PipeMap::writeStageEnd() const {}
+std::string PipeFilter::srcMemberTypeName() const { return ""; }
+std::string PipeFilter::dstMemberTypeName() const { return ""; }
+bool PipeFilter::renumbersIndex() const { return true; }
+void PipeFilter::writeCounter(bool) const {}
+void PipeFilter::writeStageEnd() const {}
+void Expression::collectReads(ReadSet&) const {}
+void ListLiteral::collectReads(ReadSet&) const {}
+void StaticListBase::collectReads(ReadSet&) const {}
+void Reference::collectReads(ReadSet&) const {}
+void Call::collectReads(ReadSet&) const {}
+void MemberCall::collectReads(ReadSet&) const {}
+void FuncReference::collectReads(ReadSet&) const {}
+void ListAppend::collectReads(ReadSet&) const {}
+void BinaryOp::collectReads(ReadSet&) const {}
+void PreUnaryOp::collectReads(ReadSet&) const {}
+void Conjunction::collectReads(ReadSet&) const {}
+void Disjunction::collectReads(ReadSet&) const {}
+void Negation::collectReads(ReadSet&) const {}
+void WriterExpr::collectReads(ReadSet&) const {}
+void ListPipeline::collectReads(ReadSet&) const {}
+void ListSlice::collectReads(ReadSet&) const {}
+void PipeKernel::collectReads(ReadSet&) const {}
+void Block::collectReads(ReadSet&) const {}
+void Arithmetics::collectReads(ReadSet&) const {}
+void Branch::collectReads(ReadSet&) const {}
+void Initialization::collectReads(ReadSet&) const {}
+void Return::collectReads(ReadSet&) const {}
+void ReturnNothing::collectReads(ReadSet&) const {}
+void Block::markLastReads(LiveSlots&) const {}
+void Arithmetics::markLastReads(LiveSlots&) const {}
+void Branch::markLastReads(LiveSlots&) const {}
+void Initialization::markLastReads(LiveSlots&) const {}
+void Return::markLastReads(LiveSlots&) const {}
+void ReturnNothing::markLastReads(LiveSlots&) const {}
+void Statement::markTailCalls(util::sref<Function const>) const {}
+void Block::markTailCalls(util::sref<Function const>) const {}
+void Branch::markTailCalls(util::sref<Function const>) const {}
+void Return::markTailCalls(util::sref<Function const>) const {}
+
+util::sref<Call const> Expression::callTo(util::serial_num) const
+{
+    return util::sref<Call const>(nullptr);
+}
+
+util::sref<Call const> Call::callTo(util::serial_num) const
+{
+    return util::sref<Call const>(nullptr);
+}
@@ -35,11 +35,11 @@ TEST_F(CallToVarTest, ArgCountWrong)
     misc::trace trace;
     trace.add(pos);
 
-    proto::Function func(pos, "shinto_shrine", std::vector<std::string>(), true);
+    proto::Function func(pos, "shinto_shrine", std::vector<util::symbol>(), true);
     proto::FuncReferenceType type(pos
                                 , util::mkref(func)
                                 , 0
-                                , std::map<std::string, proto::Variable const>());
+                                , std::map<util::symbol, proto::Variable const>());
 
     proto::Variable var(pos, util::mkref(type), 0, 0);
     var.call(std::vector<util::sref<proto::Type const>>(), trace.add(call_pos));
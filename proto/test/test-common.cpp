@@ -83,12 +83,18 @@ NodeType const test::FLOATING("floating");
 NodeType const test::EMPTY_LIST("empty list");
 NodeType const test::LIST_BEGIN("list begin");
 NodeType const test::LIST_END("list end");
+NodeType const test::STATIC_LIST_BEGIN("static list begin");
 
 NodeType const test::LIST_ELEMENT("list element");
 NodeType const test::LIST_INDEX("list index");
 NodeType const test::LIST_PIPELINE("list pipeline");
 NodeType const test::PIPE_MAP("pipe map");
 NodeType const test::PIPE_FILTER("pipe filter");
+NodeType const test::LIST_SLICE("list slice");
+NodeType const test::SLICE_BOUND("slice bound");
+NodeType const test::PIPE_KERNEL("pipe kernel");
+NodeType const test::PARALLEL_PIPELINE("parallel pipeline");
+NodeType const test::KERNEL_INVARIANT("kernel invariant");
 
 NodeType const test::REFERENCE("reference");
 NodeType const test::BINARY_OP("binary operation");
@@ -74,12 +74,18 @@ namespace test {
     extern NodeType const EMPTY_LIST;
     extern NodeType const LIST_BEGIN;
     extern NodeType const LIST_END;
+    extern NodeType const STATIC_LIST_BEGIN;
 
     extern NodeType const LIST_ELEMENT;
     extern NodeType const LIST_INDEX;
     extern NodeType const LIST_PIPELINE;
     extern NodeType const PIPE_MAP;
     extern NodeType const PIPE_FILTER;
+    extern NodeType const LIST_SLICE;
+    extern NodeType const SLICE_BOUND;
+    extern NodeType const PIPE_KERNEL;
+    extern NodeType const PARALLEL_PIPELINE;
+    extern NodeType const KERNEL_INVARIANT;
 
     extern NodeType const REFERENCE;
     extern NodeType const BINARY_OP;
@@ -241,6 +241,39 @@ TEST_F(ExprNodesTest, ListLiterals)
     ;
 }
 
+TEST_F(ExprNodesTest, LiteralLists)
+{
+    misc::position pos(10);
+    misc::trace trace;
+
+    std::vector<platform::int_type> ints;
+    ints.push_back(1);
+    ints.push_back(1);
+    ints.push_back(2);
+    proto::LiteralList<platform::int_type> ls_a(pos, ints);
+    ls_a.inst(*global_st, trace)->write();
+    EXPECT_EQ(ls_a.type(*global_st, trace), proto::ListType::getListType(proto::Type::s_int()));
+
+    proto::LiteralList<platform::float_type> ls_b(pos, std::vector<platform::float_type>(2, 0.5));
+    EXPECT_EQ(ls_b.type(*global_st, trace), proto::ListType::getListType(proto::Type::s_float()));
+
+    proto::LiteralList<bool> ls_c(pos, std::vector<bool>(1, true));
+    ls_c.inst(*global_st, trace)->write();
+    EXPECT_EQ(ls_c.type(*global_st, trace), proto::ListType::getListType(proto::Type::s_bool()));
+    EXPECT_FALSE(error::hasError());
+
+    DataTree::expectOne()
+        (STATIC_LIST_BEGIN)
+            (INTEGER, "1")
+            (INTEGER, "1")
+            (INTEGER, "2")
+        (LIST_END)
+        (STATIC_LIST_BEGIN)
+            (BOOLEAN, "true")
+        (LIST_END)
+    ;
+}
+
 TEST_F(ExprNodesTest, EmptyListLiterals)
 {
     misc::position pos(9);
@@ -35,7 +35,7 @@ TEST_F(FuncNCallTest, EmptyBodyFunc)
     misc::trace trace;
     trace.add(pos);
     util::sref<proto::Function> func(
-            block->declare(pos, "empty_body", std::vector<std::string>(), true));
+            block->declare(pos, "empty_body", std::vector<util::symbol>(), true));
     ASSERT_FALSE(error::hasError());
 
     proto::Call call(pos, func, std::vector<util::sptr<proto::Expression const>>());
@@ -53,7 +53,7 @@ TEST_F(FuncNCallTest, NoBranchRecursionFunc)
     misc::trace trace;
     trace.add(pos);
     util::sref<proto::Function> func(
-            block->declare(pos, "first", std::vector<std::string>(), true));
+            block->declare(pos, "first", std::vector<util::symbol>(), true));
     ASSERT_FALSE(error::hasError());
 
     BlockFiller(func->block())
@@ -63,7 +63,7 @@ TEST_F(FuncNCallTest, NoBranchRecursionFunc)
     call_first.inst(*global_st, trace)->write();
     ASSERT_FALSE(error::hasError());
 
-    func = block->declare(pos, "second", std::vector<std::string>(), false);
+    func = block->declare(pos, "second", std::vector<util::symbol>(), false);
     BlockFiller(func->block())
         .ret(pos, util::mkptr(new proto::IntLiteral(pos, mpz_class(20110127))))
     ;
@@ -71,7 +71,7 @@ TEST_F(FuncNCallTest, NoBranchRecursionFunc)
     call_second.inst(*global_st, trace)->write();
     ASSERT_FALSE(error::hasError());
 
-    func = block->declare(pos, "second", std::vector<std::string>({ "x" }), false);
+    func = block->declare(pos, "second", std::vector<util::symbol>({ "x" }), false);
     BlockFiller(func->block())
         .ret(pos, util::mkptr(new proto::Reference(pos, "x")))
     ;
@@ -97,7 +97,7 @@ TEST_F(FuncNCallTest, FuncWithBranchRecursion)
     util::sptr<proto::Block> sub0(new proto::Block);
     util::sptr<proto::Block> sub1(new proto::Block);
     util::sref<proto::Function> test_func(
-            block->declare(pos, "test_func", std::vector<std::string>({ "x" }), false));
+            block->declare(pos, "test_func", std::vector<util::symbol>({ "x" }), false));
 
     std::vector<util::sptr<proto::Expression const>> args;
     args.push_back(util::mkptr(new proto::BoolLiteral(pos, true)));
@@ -128,7 +128,7 @@ TEST_F(FuncNCallTest, CannotResolve)
     util::sptr<proto::Block> sub0(new proto::Block);
     util::sptr<proto::Block> sub1(new proto::Block);
     util::sref<proto::Function> test_func(
-            block->declare(pos, "test_func", std::vector<std::string>(), false));
+            block->declare(pos, "test_func", std::vector<util::symbol>(), false));
 
     misc::position bad_call_pos(200);
     BlockFiller(test_func->block())
@@ -158,7 +158,7 @@ TEST_F(FuncNCallTest, ConflictReturnType)
     util::sptr<proto::Block> sub0(new proto::Block);
     util::sptr<proto::Block> sub1(new proto::Block);
     util::sref<proto::Function> test_func(
-            block->declare(pos, "kyubee", std::vector<std::string>({ "x" }), false));
+            block->declare(pos, "kyubee", std::vector<util::symbol>({ "x" }), false));
 
     misc::position ret_pos_a(300);
     misc::position ret_pos_b(301);
@@ -197,7 +197,7 @@ TEST_F(FuncNCallTest, WriteEmptyFunc)
     misc::trace trace;
     trace.add(pos);
     util::sref<proto::Function> func(
-            block->declare(pos, "empty_body", std::vector<std::string>(), true));
+            block->declare(pos, "empty_body", std::vector<util::symbol>(), true));
     ASSERT_FALSE(error::hasError());
 
     proto::Call call(pos, func, std::vector<util::sptr<proto::Expression const>>());
@@ -227,9 +227,9 @@ TEST_F(FuncNCallTest, WriteNestedCallInBranches)
     util::sptr<proto::Block> sub1(new proto::Block);
 
     util::sref<proto::Function> func(
-            block->declare(pos, "f0", std::vector<std::string>({ "x" }), false));
+            block->declare(pos, "f0", std::vector<util::symbol>({ "x" }), false));
     util::sref<proto::Function> nested(
-            func->block()->declare(pos, "n0", std::vector<std::string>(), false));
+            func->block()->declare(pos, "n0", std::vector<util::symbol>(), false));
 
     std::vector<util::sptr<proto::Expression const>> call_args;
     call_args.push_back(util::mkptr(new proto::BoolLiteral(pos, true)));
@@ -296,9 +296,9 @@ TEST_F(FuncNCallTest, WriteNestedCallOutsideBranches)
     util::sptr<proto::Block> sub1(new proto::Block);
 
     util::sref<proto::Function> func(
-            block->declare(pos, "f0", std::vector<std::string>({ "x" }), false));
+            block->declare(pos, "f0", std::vector<util::symbol>({ "x" }), false));
     util::sref<proto::Function> nested(
-            func->block()->declare(pos, "n0", std::vector<std::string>(), false));
+            func->block()->declare(pos, "n0", std::vector<util::symbol>(), false));
 
     std::vector<util::sptr<proto::Expression const>> call_args;
     call_args.push_back(util::mkptr(new proto::BoolLiteral(pos, true)));
@@ -355,3 +355,33 @@ TEST_F(FuncNCallTest, WriteNestedCallOutsideBranches)
             (BLOCK_END)
     ;
 }
+
+TEST_F(FuncNCallTest, ReuseDraftsByLocationAndTypes)
+{
+    misc::position pos(5);
+    misc::trace trace;
+    trace.add(pos);
+    util::sref<proto::Function> func(
+            block->declare(pos, "reuse", std::vector<util::symbol>({ "x" }), true));
+    func->setFreeVariables(std::vector<util::symbol>({ "y" }));
+    global_st->defVar(pos, proto::Type::s_int(), "y");
+
+    proto::SymbolTable same_location_st;
+    same_location_st.defVar(pos, proto::Type::s_int(), "y");
+    proto::SymbolTable other_location_st;
+    other_location_st.defVar(pos, proto::Type::s_float(), "z");
+    other_location_st.defVar(pos, proto::Type::s_int(), "y");
+
+    std::vector<util::sref<proto::Type const>> int_arg({ proto::Type::s_int() });
+    std::vector<util::sref<proto::Type const>> bool_arg({ proto::Type::s_bool() });
+    util::sref<proto::FuncInstDraft> draft(func->inst(*global_st, int_arg, trace));
+    ASSERT_FALSE(error::hasError());
+
+    ASSERT_EQ(draft.id(), func->inst(*global_st, int_arg, trace).id());
+    ASSERT_EQ(draft.id(), func->inst(util::mkref(same_location_st), int_arg, trace).id());
+    ASSERT_NE(draft.id(), func->inst(*global_st, bool_arg, trace).id());
+    ASSERT_NE(draft.id(), func->inst(util::mkref(other_location_st), int_arg, trace).id());
+    ASSERT_FALSE(error::hasError());
+
+    ASSERT_EQ(3, func->deliverFuncs().size());
+}
@@ -133,3 +133,308 @@ TEST_F(ListPipeTest, FilterType)
             , pl1.typeAsPipe(*global_st, *context, trace));
     ASSERT_FALSE(error::hasError());
 }
+
+TEST_F(ListPipeTest, IndexRangeFiltersAsSlices)
+{
+    misc::position pos(5);
+    misc::trace trace;
+    trace.add(pos);
+    global_st->defVar(pos, proto::Type::s_int(), "n");
+
+    std::vector<util::sptr<proto::Expression const>> ls;
+    ls.push_back(util::mkptr(new proto::IntLiteral(pos, mpz_class(0))));
+    util::sptr<proto::ListLiteral const> list(new proto::ListLiteral(pos, std::move(ls)));
+
+    std::vector<util::sptr<proto::PipeBase const>> pipes;
+    util::sptr<proto::Expression const> range0(
+            new proto::Conjunction(
+                    pos
+                  , util::mkptr(new proto::BinaryOp(
+                                        pos
+                                      , util::mkptr(new proto::ListIndex(pos))
+                                      , ">="
+                                      , util::mkptr(new proto::IntLiteral(pos, mpz_class(1)))))
+                  , util::mkptr(new proto::BinaryOp(
+                                        pos
+                                      , util::mkptr(new proto::Reference(pos, "n"))
+                                      , ">"
+                                      , util::mkptr(new proto::ListIndex(pos))))));
+    pipes.push_back(util::mkptr(new proto::PipeFilter(std::move(range0))));
+    util::sptr<proto::Expression const> range1(
+            new proto::BinaryOp(pos
+                              , util::mkptr(new proto::ListIndex(pos))
+                              , "<"
+                              , util::mkptr(new proto::Reference(pos, "n"))));
+    pipes.push_back(util::mkptr(new proto::PipeFilter(std::move(range1))));
+    util::sptr<proto::Expression const> not_range(
+            new proto::BinaryOp(pos
+                              , util::mkptr(new proto::ListIndex(pos))
+                              , "<"
+                              , util::mkptr(new proto::ListElement(pos))));
+    pipes.push_back(util::mkptr(new proto::PipeFilter(std::move(not_range))));
+    util::sptr<proto::Expression const> after_map(
+            new proto::BinaryOp(pos
+                              , util::mkptr(new proto::ListIndex(pos))
+                              , "<"
+                              , util::mkptr(new proto::IntLiteral(pos, mpz_class(2)))));
+    pipes.push_back(util::mkptr(new proto::PipeFilter(std::move(after_map))));
+
+    proto::ListPipeline pipeline(pos, std::move(list), std::move(pipes));
+    pipeline.inst(*global_st, trace)->write();
+    ASSERT_FALSE(error::hasError());
+
+    DataTree::expectOne()
+        (LIST_PIPELINE, "2")
+            (LIST_SLICE, "1")
+                (LIST_SLICE, "2")
+                    (LIST_BEGIN)
+                        (INTEGER, "0")
+                    (LIST_END)
+                    (SLICE_BOUND, ">=")
+                        (INTEGER, "1")
+                    (SLICE_BOUND, "<")
+                        (REFERENCE)
+                (SLICE_BOUND, "<")
+                    (REFERENCE)
+            (PIPE_FILTER, "1")
+            (PIPE_FILTER, "1")
+    ;
+}
+
+TEST_F(ListPipeTest, TrappingBoundsStayFilters)
+{
+    misc::position pos(5);
+    misc::trace trace;
+    trace.add(pos);
+    global_st->defVar(pos, proto::Type::s_int(), "n");
+
+    std::vector<util::sptr<proto::Expression const>> ls;
+    ls.push_back(util::mkptr(new proto::IntLiteral(pos, mpz_class(0))));
+    util::sptr<proto::ListLiteral const> list(new proto::ListLiteral(pos, std::move(ls)));
+
+    std::vector<util::sptr<proto::PipeBase const>> pipes;
+    util::sptr<proto::Expression const> quotient(
+            new proto::BinaryOp(pos
+                              , util::mkptr(new proto::ListIndex(pos))
+                              , "<"
+                              , util::mkptr(new proto::BinaryOp(
+                                        pos
+                                      , util::mkptr(new proto::IntLiteral(pos, mpz_class(10)))
+                                      , "/"
+                                      , util::mkptr(new proto::Reference(pos, "n"))))));
+    pipes.push_back(util::mkptr(new proto::PipeFilter(std::move(quotient))));
+    util::sptr<proto::Expression const> remainder(
+            new proto::Conjunction(
+                    pos
+                  , util::mkptr(new proto::BinaryOp(
+                                        pos
+                                      , util::mkptr(new proto::ListIndex(pos))
+                                      , ">="
+                                      , util::mkptr(new proto::IntLiteral(pos, mpz_class(1)))))
+                  , util::mkptr(new proto::BinaryOp(
+                                        pos
+                                      , util::mkptr(new proto::ListIndex(pos))
+                                      , "<"
+                                      , util::mkptr(new proto::PreUnaryOp(
+                                                pos
+                                              , "-"
+                                              , util::mkptr(new proto::BinaryOp(
+                                                        pos
+                                                      , util::mkptr(new proto::Reference(pos, "n"))
+                                                      , "%"
+                                                      , util::mkptr(new proto::IntLiteral(
+                                                                pos, mpz_class(3)))))))))));
+    pipes.push_back(util::mkptr(new proto::PipeFilter(std::move(remainder))));
+
+    proto::ListPipeline pipeline(pos, std::move(list), std::move(pipes));
+    pipeline.inst(*global_st, trace)->write();
+    ASSERT_FALSE(error::hasError());
+
+    DataTree::expectOne()
+        (LIST_PIPELINE, "2")
+            (LIST_BEGIN)
+                (INTEGER, "0")
+            (LIST_END)
+            (PIPE_FILTER, "1")
+            (PIPE_FILTER, "1")
+    ;
+}
+
+TEST_F(ListPipeTest, ArithmeticMapsAsKernel)
+{
+    misc::position pos(6);
+    misc::trace trace;
+    trace.add(pos);
+    global_st->defVar(pos, proto::Type::s_float(), "x");
+
+    std::vector<util::sptr<proto::Expression const>> ls;
+    ls.push_back(util::mkptr(new proto::FloatLiteral(pos, mpf_class(0.5))));
+    util::sptr<proto::ListLiteral const> list(new proto::ListLiteral(pos, std::move(ls)));
+
+    std::vector<util::sptr<proto::PipeBase const>> pipes;
+    pipes.push_back(util::mkptr(new proto::PipeMap(
+            util::mkptr(new proto::BinaryOp(pos
+                                          , util::mkptr(new proto::ListElement(pos))
+                                          , "*"
+                                          , util::mkptr(new proto::Reference(pos, "x")))))));
+    pipes.push_back(util::mkptr(new proto::PipeMap(
+            util::mkptr(new proto::BinaryOp(
+                    pos
+                  , util::mkptr(new proto::PreUnaryOp(pos
+                                                    , "-"
+                                                    , util::mkptr(new proto::ListElement(pos))))
+                  , "/"
+                  , util::mkptr(new proto::FloatLiteral(pos, mpf_class(1.5))))))));
+
+    proto::ListPipeline pipeline(pos, std::move(list), std::move(pipes));
+    pipeline.inst(*global_st, trace)->write();
+    ASSERT_FALSE(error::hasError());
+
+    DataTree::expectOne()
+        (PIPE_KERNEL, "2", 2)
+            (LIST_BEGIN)
+                (FLOATING, "0.5")
+            (LIST_END)
+            (REFERENCE)
+            (FLOATING, "1.5")
+            (BINARY_OP, "*")
+                (LIST_ELEMENT)
+                (KERNEL_INVARIANT, "0")
+            (BINARY_OP, "/")
+                (PRE_UNARY_OP, "-")
+                    (LIST_ELEMENT)
+                (KERNEL_INVARIANT, "1")
+    ;
+}
+
+TEST_F(ListPipeTest, NoKernelForIntDivision)
+{
+    misc::position pos(7);
+    misc::trace trace;
+    trace.add(pos);
+
+    std::vector<util::sptr<proto::Expression const>> ls;
+    ls.push_back(util::mkptr(new proto::IntLiteral(pos, mpz_class(8))));
+    util::sptr<proto::ListLiteral const> list(new proto::ListLiteral(pos, std::move(ls)));
+
+    std::vector<util::sptr<proto::PipeBase const>> pipes;
+    pipes.push_back(util::mkptr(new proto::PipeMap(
+            util::mkptr(new proto::BinaryOp(pos
+                                          , util::mkptr(new proto::ListIndex(pos))
+                                          , "+"
+                                          , util::mkptr(new proto::ListElement(pos)))))));
+    pipes.push_back(util::mkptr(new proto::PipeMap(
+            util::mkptr(new proto::BinaryOp(pos
+                                          , util::mkptr(new proto::ListElement(pos))
+                                          , "/"
+                                          , util::mkptr(new proto::IntLiteral(pos, mpz_class(2))))))));
+
+    proto::ListPipeline pipeline(pos, std::move(list), std::move(pipes));
+    pipeline.inst(*global_st, trace)->write();
+    ASSERT_FALSE(error::hasError());
+
+    DataTree::expectOne()
+        (PARALLEL_PIPELINE, "2")
+            (LIST_BEGIN)
+                (INTEGER, "8")
+            (LIST_END)
+            (PIPE_MAP, "1")
+            (PIPE_MAP, "0")
+    ;
+}
+
+TEST_F(ListPipeTest, ParallelPipelines)
+{
+    misc::position pos(8);
+    misc::trace trace;
+    trace.add(pos);
+
+    std::vector<util::sptr<proto::Expression const>> ls0;
+    ls0.push_back(util::mkptr(new proto::IntLiteral(pos, mpz_class(3))));
+    std::vector<util::sptr<proto::PipeBase const>> pipes0;
+    pipes0.push_back(util::mkptr(new proto::PipeFilter(
+            util::mkptr(new proto::BinaryOp(pos
+                                          , util::mkptr(new proto::ListElement(pos))
+                                          , ">"
+                                          , util::mkptr(new proto::ListIndex(pos)))))));
+    pipes0.push_back(util::mkptr(new proto::PipeMap(
+            util::mkptr(new proto::BinaryOp(pos
+                                          , util::mkptr(new proto::ListElement(pos))
+                                          , "="
+                                          , util::mkptr(new proto::IntLiteral(pos, mpz_class(1))))))));
+    proto::ListPipeline parallel(
+            pos, util::mkptr(new proto::ListLiteral(pos, std::move(ls0))), std::move(pipes0));
+    parallel.inst(*global_st, trace)->write();
+
+    std::vector<util::sptr<proto::Expression const>> ls1;
+    ls1.push_back(util::mkptr(new proto::IntLiteral(pos, mpz_class(4))));
+    std::vector<util::sptr<proto::PipeBase const>> pipes1;
+    pipes1.push_back(util::mkptr(new proto::PipeFilter(
+            util::mkptr(new proto::BinaryOp(pos
+                                          , util::mkptr(new proto::ListElement(pos))
+                                          , ">"
+                                          , util::mkptr(new proto::IntLiteral(pos, mpz_class(1))))))));
+    pipes1.push_back(util::mkptr(new proto::PipeMap(
+            util::mkptr(new proto::BinaryOp(pos
+                                          , util::mkptr(new proto::ListElement(pos))
+                                          , "*"
+                                          , util::mkptr(new proto::ListIndex(pos)))))));
+    proto::ListPipeline index_after_filter(
+            pos, util::mkptr(new proto::ListLiteral(pos, std::move(ls1))), std::move(pipes1));
+    index_after_filter.inst(*global_st, trace)->write();
+    ASSERT_FALSE(error::hasError());
+
+    DataTree::expectOne()
+        (PARALLEL_PIPELINE, "2")
+            (LIST_BEGIN)
+                (INTEGER, "3")
+            (LIST_END)
+            (PIPE_FILTER, "1")
+            (PIPE_MAP, "0")
+        (LIST_PIPELINE, "2")
+            (LIST_BEGIN)
+                (INTEGER, "4")
+            (LIST_END)
+            (PIPE_FILTER, "0")
+            (PIPE_MAP, "1")
+    ;
+}
+
+TEST_F(ListPipeTest, IndexReadInNestedExpressions)
+{
+    misc::position pos(9);
+    misc::trace trace;
+    trace.add(pos);
+
+    std::vector<util::sptr<proto::Expression const>> ls;
+    ls.push_back(util::mkptr(new proto::IntLiteral(pos, mpz_class(5))));
+    util::sptr<proto::ListLiteral const> list(new proto::ListLiteral(pos, std::move(ls)));
+
+    std::vector<util::sptr<proto::PipeBase const>> pipes;
+    std::vector<util::sptr<proto::Expression const>> element_members;
+    element_members.push_back(util::mkptr(new proto::ListElement(pos)));
+    std::vector<util::sptr<proto::Expression const>> int_members;
+    int_members.push_back(util::mkptr(new proto::IntLiteral(pos, mpz_class(6))));
+    pipes.push_back(util::mkptr(new proto::PipeMap(
+            util::mkptr(new proto::ListAppend(
+                    pos
+                  , util::mkptr(new proto::ListLiteral(pos, std::move(element_members)))
+                  , util::mkptr(new proto::ListLiteral(pos, std::move(int_members))))))));
+    std::vector<util::sptr<proto::Expression const>> index_members;
+    index_members.push_back(util::mkptr(new proto::ListIndex(pos)));
+    pipes.push_back(util::mkptr(new proto::PipeMap(
+            util::mkptr(new proto::ListLiteral(pos, std::move(index_members))))));
+
+    proto::ListPipeline pipeline(pos, std::move(list), std::move(pipes));
+    pipeline.inst(*global_st, trace)->write();
+    ASSERT_FALSE(error::hasError());
+
+    DataTree::expectOne()
+        (LIST_PIPELINE, "2")
+            (LIST_BEGIN)
+                (INTEGER, "5")
+            (LIST_END)
+            (PIPE_MAP, "0")
+            (PIPE_MAP, "1")
+    ;
+}
@@ -223,3 +223,35 @@ TEST_F(QueryOperationTest, BadOperation)
     ASSERT_EQ("-", getNAPreUnaryOps()[0].op_img);
     ASSERT_EQ(proto::Type::s_void()->name(), getNAPreUnaryOps()[0].rhst_name);
 }
+
+TEST_F(QueryOperationTest, InternedOperators)
+{
+    int add_id = proto::Operation::binaryOpId("+");
+    ASSERT_EQ(add_id, proto::Operation::binaryOpId("+"));
+    ASSERT_NE(add_id, proto::Operation::binaryOpId("-"));
+    ASSERT_NE(add_id, proto::Operation::binaryOpId("="));
+
+    util::sref<proto::Operation const> result = proto::Operation::queryBinary(
+                misc::position(14), add_id, proto::Type::s_int(), proto::Type::s_float());
+    ASSERT_FALSE(error::hasError());
+    ASSERT_EQ(proto::Type::s_float(), result->ret_type);
+
+    int spaceship_id = proto::Operation::binaryOpId("<=>");
+    ASSERT_EQ(spaceship_id, proto::Operation::binaryOpId("<=>"));
+    ASSERT_NE(add_id, spaceship_id);
+    result = proto::Operation::queryBinary(
+                misc::position(15), spaceship_id, proto::Type::s_int(), proto::Type::s_int());
+    ASSERT_TRUE(error::hasError());
+    ASSERT_EQ(proto::Type::bad(), result->ret_type);
+    ASSERT_EQ(1, getNABinaryOps().size());
+    ASSERT_EQ(misc::position(15), getNABinaryOps()[0].pos);
+    ASSERT_EQ("<=>", getNABinaryOps()[0].op_img);
+    clearErr();
+
+    result = proto::Operation::queryPreUnary(
+                misc::position(16), proto::Operation::preUnaryOpId("!"), proto::Type::s_bool());
+    ASSERT_TRUE(error::hasError());
+    ASSERT_EQ(proto::Type::bad(), result->ret_type);
+    ASSERT_EQ(1, getNAPreUnaryOps().size());
+    ASSERT_EQ("!", getNAPreUnaryOps()[0].op_img);
+}
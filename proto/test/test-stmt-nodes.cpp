@@ -36,8 +36,8 @@ TEST_F(StmtNodesTest, BranchConditionTypeCheck)
     global_st->defVar(pos_d, proto::Type::s_int(), "kokopelli");
     util::sptr<proto::Block> block(new proto::Block);
 
-    util::sref<proto::Function> func(block->declare(pos_d, "f", std::vector<std::string>(), true));
-    func->setFreeVariables(std::vector<std::string>{ "kokopelli" });
+    util::sref<proto::Function> func(block->declare(pos_d, "f", std::vector<util::symbol>(), true));
+    func->setFreeVariables(std::vector<util::symbol>{ "kokopelli" });
     BlockFiller(func->block())
         .branch(pos
               , util::mkptr(new proto::Reference(pos, "kokopelli"))
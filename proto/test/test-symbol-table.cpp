@@ -225,7 +225,7 @@ TEST_F(SymbolTableTest, NestedOnCorrect)
     ASSERT_FALSE(error::hasError());
 
     std::list<proto::ArgNameTypeRec> args_info_a = {};
-    std::map<std::string, proto::Variable const> ext_vars = {
+    std::map<util::symbol, proto::Variable const> ext_vars = {
         { "alice", alice },
         { "bob", bob },
         { "claire", claire },
@@ -1,5 +1,6 @@
 #include <gtest/gtest.h>
 
+#include <misc/platform.h>
 #include <test/phony-errors.h>
 
 #include "test-common.h"
@@ -106,3 +107,16 @@ TEST_F(TypesTest, IsListType)
     EXPECT_FALSE(proto::ListType::isListType(proto::Type::s_float()));
     EXPECT_FALSE(proto::ListType::isListType(proto::Type::s_bool()));
 }
+
+TEST_F(TypesTest, ListTypeSizes)
+{
+    int handle_size = proto::ListType::getListType(proto::Type::s_void())->size;
+    EXPECT_EQ(handle_size + platform::LIST_INLINE_SIZE
+            , proto::ListType::getListType(proto::Type::s_int())->size);
+    EXPECT_EQ(handle_size + platform::LIST_INLINE_SIZE
+            , proto::ListType::getListType(proto::Type::s_float())->size);
+    EXPECT_EQ(handle_size + platform::LIST_INLINE_SIZE
+            , proto::ListType::getListType(proto::Type::s_bool())->size);
+    EXPECT_EQ(handle_size
+            , proto::ListType::getListType(proto::ListType::getListType(proto::Type::s_int()))->size);
+}
@@ -13,8 +13,8 @@ namespace {
     struct BuiltInPrimitive
         : public Type
     {
-        BuiltInPrimitive(std::string const& n, int size)
-            : Type(size)
+        BuiltInPrimitive(std::string const& n, int size, int primitive_index)
+            : Type(size, primitive_index)
             , tname(n)
         {}
 
@@ -37,7 +37,7 @@ namespace {
         : public BuiltInPrimitive
     {
         BadType()
-            : BuiltInPrimitive("*BAD STEKIN TYPE*", 0)
+            : BuiltInPrimitive("*BAD STEKIN TYPE*", 0, NOT_PRIMITIVE)
         {}
 
         util::sptr<inst::Type const> makeInstType() const
@@ -51,7 +51,7 @@ namespace {
         : public BuiltInPrimitive
     {
         VoidPrimitive()
-            : BuiltInPrimitive("void", 0)
+            : BuiltInPrimitive("void", 0, NOT_PRIMITIVE)
         {}
 
         util::sptr<inst::Type const> makeInstType() const
@@ -65,7 +65,7 @@ namespace {
         : public BuiltInPrimitive
     {
         BoolPrimitive()
-            : BuiltInPrimitive("bool", platform::BOOL_SIZE)
+            : BuiltInPrimitive("bool", platform::BOOL_SIZE, 0)
         {}
 
         util::sptr<inst::Type const> makeInstType() const
@@ -79,7 +79,7 @@ namespace {
         : public BuiltInPrimitive
     {
         IntPrimitive()
-            : BuiltInPrimitive("int", platform::INT_SIZE)
+            : BuiltInPrimitive("int", platform::INT_SIZE, 1)
         {}
 
         util::sptr<inst::Type const> makeInstType() const
@@ -93,7 +93,7 @@ namespace {
         : public BuiltInPrimitive
     {
         FloatPrimitive()
-            : BuiltInPrimitive("float", platform::FLOAT_SIZE)
+            : BuiltInPrimitive("float", platform::FLOAT_SIZE, 2)
         {}
 
         util::sptr<inst::Type const> makeInstType() const
@@ -14,11 +14,21 @@
 namespace proto {
 
     struct Type {
-        explicit Type(int s)
+        explicit Type(int s, int pi = NOT_PRIMITIVE)
             : size(s)
+            , primitive_index(pi)
         {}
     public:
         int const size;
+
+        /*
+         * Dense index of bool, int and float, under PRIMITIVE_COUNT, for tables
+         * of operations; other types are NOT_PRIMITIVE.
+         */
+        int const primitive_index;
+
+        static int const NOT_PRIMITIVE = -1;
+        static int const PRIMITIVE_COUNT = 3;
     public:
         virtual util::sptr<inst::Type const> makeInstType() const = 0;
         virtual std::string name() const = 0;
@@ -252,3 +252,10 @@ void error::featureNotSupportWrapListInClosure(misc::position const& pos)
     std::cerr << "    feature not supported: wrap list in closure." << std::endl;
     std::cerr << "    will be fixed in future." << std::endl;
 }
+
+void error::outputFailed(std::string const& reason)
+{
+    has_error = true;
+    std::cerr << "Output:" << std::endl;
+    std::cerr << "    fail to write generated code: " << reason << "." << std::endl;
+}
@@ -67,6 +67,8 @@ namespace error {
 
     void featureNotSupportWrapListInClosure(misc::position const& pos);
 
+    void outputFailed(std::string const& reason);
+
 }
 
 #endif /* __STEKIN_REPORT_ERRORS_H__ */
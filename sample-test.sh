@@ -33,3 +33,15 @@ verify ifte
 verify basic-list
 verify return-list
 verify list-pipe
+verify list-accumulate
+verify list-concat
+verify pipe-chain
+verify list-slice
+verify list-kernel
+verify list-parallel
+verify list-frame
+verify list-inline
+verify list-literal
+verify tail-call
+verify list-empty
+verify pipe-write-order
@@ -11,5 +11,5 @@ else
 fi
 $CHECK_MEMORY ./head-writer.out > ./tmp.cpp && \
 cat output/src-cp.cpp >> ./tmp.cpp && \
-$CHECK_MEMORY ./stkn-core.out < $INPUT >> ./tmp.cpp && \
-g++ tmp.cpp -o $OUTPUT
+$CHECK_MEMORY ./stkn-core.out $STKN_OPTIONS < $INPUT >> ./tmp.cpp && \
+g++ -pthread $STKN_CXXFLAGS tmp.cpp -o $OUTPUT
@@ -399,3 +399,4 @@ std::vector<PipeNotApplyOnList> test::getPipeNotApplyOnList()
 }
 
 void error::featureNotSupportWrapListInClosure(misc::position const&) {}
+void error::outputFailed(std::string const&) {}
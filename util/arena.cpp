@@ -0,0 +1,48 @@
+#include <algorithm>
+
+#include "arena.h"
+
+using namespace util;
+
+static std::size_t const CHUNK_SIZE = 64 * 1024;
+static std::size_t const ALIGNMENT = alignof(std::max_align_t);
+
+arena::~arena()
+{
+    release(0);
+}
+
+void* arena::allocate(std::size_t size)
+{
+    size = (size + ALIGNMENT - 1) / ALIGNMENT * ALIGNMENT;
+    if (size > CHUNK_SIZE / 4) {
+        _chunks.push_back(new char[size]);
+        return _chunks.back();
+    }
+    if (std::size_t(_end - _next) < size) {
+        _chunks.push_back(new char[CHUNK_SIZE]);
+        _next = _chunks.back();
+        _end = _next + CHUNK_SIZE;
+    }
+    void* result = _next;
+    _next += size;
+    return result;
+}
+
+std::size_t arena::mark()
+{
+    _next = _end = nullptr;
+    return _chunks.size();
+}
+
+void arena::release(std::size_t mark)
+{
+    std::for_each(_chunks.begin() + mark
+                , _chunks.end()
+                , [&](char* chunk)
+                  {
+                      delete[] chunk;
+                  });
+    _chunks.resize(mark);
+    _next = _end = nullptr;
+}
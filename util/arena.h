@@ -0,0 +1,59 @@
+#ifndef __STEKIN_UTILITY_ARENA_H__
+#define __STEKIN_UTILITY_ARENA_H__
+
+#include <cstddef>
+#include <vector>
+
+namespace util {
+
+    /*
+     * A bump allocator that never frees single objects.  A compilation phase
+     * takes a mark before building its tree and, once the tree is destroyed,
+     * releases every chunk allocated since the mark in one go.  Memory taken
+     * before the mark, by nodes built during static initialization for
+     * example, stays valid.
+     */
+    struct arena {
+        arena()
+            : _next(nullptr)
+            , _end(nullptr)
+        {}
+
+        ~arena();
+
+        void* allocate(std::size_t size);
+        std::size_t mark();
+        void release(std::size_t mark);
+    private:
+        std::vector<char*> _chunks;
+        char* _next;
+        char* _end;
+
+        arena(arena const&) = delete;
+    };
+
+    /*
+     * Base of node classes allocated from the arena of their phase; deleting
+     * such a node runs its destructor and leaves the memory to the arena.  The
+     * arena itself is never destroyed, so nodes owned by static objects are
+     * always destroyed before their memory goes away.
+     */
+    template <typename _Phase>
+    struct arena_allocated {
+        static arena& nodes_arena()
+        {
+            static arena* const nodes = new arena;
+            return *nodes;
+        }
+
+        static void* operator new(std::size_t size)
+        {
+            return nodes_arena().allocate(size);
+        }
+
+        static void operator delete(void*) {}
+    };
+
+}
+
+#endif /* __STEKIN_UTILITY_ARENA_H__ */
@@ -0,0 +1,24 @@
+#include <unordered_set>
+
+#include "symbol.h"
+
+using namespace util;
+
+static std::string const* intern(std::string const& name)
+{
+    static std::unordered_set<std::string> images;
+    return &*images.insert(name).first;
+}
+
+symbol::symbol(std::string const& name)
+    : _image(intern(name))
+{}
+
+symbol::symbol(char const* name)
+    : _image(intern(name))
+{}
+
+bool symbol::operator<(symbol rhs) const
+{
+    return _image != rhs._image && *_image < *rhs._image;
+}
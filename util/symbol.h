@@ -0,0 +1,58 @@
+#ifndef __STEKIN_UTILITY_SYMBOL_H__
+#define __STEKIN_UTILITY_SYMBOL_H__
+
+#include <string>
+#include <functional>
+
+namespace util {
+
+    /*
+     * An identifier interned into a global string table.  Equal names share one
+     * image, so copying is a pointer copy and equality and hashing never look at
+     * the characters.  operator< still orders by the text, keeping ordered maps
+     * keyed by symbols in the same order as the names themselves.
+     */
+    struct symbol {
+        symbol(std::string const& name);
+        symbol(char const* name);
+
+        std::string const& str() const
+        {
+            return *_image;
+        }
+
+        bool operator<(symbol rhs) const;
+
+        friend bool operator==(symbol lhs, symbol rhs)
+        {
+            return lhs._image == rhs._image;
+        }
+
+        friend bool operator!=(symbol lhs, symbol rhs)
+        {
+            return lhs._image != rhs._image;
+        }
+
+        std::size_t hash() const
+        {
+            return std::hash<std::string const*>()(_image);
+        }
+    private:
+        std::string const* _image;
+    };
+
+}
+
+namespace std {
+
+    template <>
+    struct hash<util::symbol> {
+        size_t operator()(util::symbol s) const
+        {
+            return s.hash();
+        }
+    };
+
+}
+
+#endif /* __STEKIN_UTILITY_SYMBOL_H__ */
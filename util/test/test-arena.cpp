@@ -0,0 +1,69 @@
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "../arena.h"
+#include "../pointer.h"
+
+namespace {
+
+    struct Counted
+        : public util::arena_allocated<Counted>
+    {
+        explicit Counted(int& c)
+            : count(c)
+        {
+            ++count;
+        }
+
+        ~Counted()
+        {
+            --count;
+        }
+
+        int& count;
+        char payload[40];
+    };
+
+}
+
+TEST(Arena, AllocateAligned)
+{
+    util::arena a;
+    char* x = static_cast<char*>(a.allocate(1));
+    char* y = static_cast<char*>(a.allocate(24));
+    char* z = static_cast<char*>(a.allocate(1 << 20));
+    ASSERT_EQ(0, reinterpret_cast<std::size_t>(y) % alignof(std::max_align_t));
+    ASSERT_EQ(alignof(std::max_align_t), std::size_t(y - x));
+    ASSERT_NE(nullptr, z);
+    z[(1 << 20) - 1] = 0;
+}
+
+TEST(Arena, ReleaseToMark)
+{
+    util::arena a;
+    char* kept = static_cast<char*>(a.allocate(8));
+    std::size_t mark = a.mark();
+    for (int i = 0; i < 10000; ++i) {
+        a.allocate(32);
+    }
+    a.release(mark);
+    kept[7] = 1;
+    char* after = static_cast<char*>(a.allocate(8));
+    ASSERT_NE(kept, after);
+}
+
+TEST(Arena, NodesDestroyedNotFreed)
+{
+    int count = 0;
+    util::arena& nodes = util::arena_allocated<Counted>::nodes_arena();
+    std::size_t mark = nodes.mark();
+    {
+        std::vector<util::sptr<Counted>> owned;
+        for (int i = 0; i < 100; ++i) {
+            owned.push_back(util::mkptr(new Counted(count)));
+        }
+        ASSERT_EQ(100, count);
+    }
+    ASSERT_EQ(0, count);
+    nodes.release(mark);
+}
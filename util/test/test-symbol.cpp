@@ -0,0 +1,31 @@
+#include <gtest/gtest.h>
+
+#include "../symbol.h"
+
+TEST(Symbol, Intern)
+{
+    util::symbol a("count");
+    util::symbol b(std::string("co") + "unt");
+    util::symbol c("counter");
+
+    ASSERT_TRUE(a == b);
+    ASSERT_FALSE(a != b);
+    ASSERT_EQ(&a.str(), &b.str());
+    ASSERT_EQ(a.hash(), b.hash());
+
+    ASSERT_TRUE(a != c);
+    ASSERT_EQ("count", a.str());
+    ASSERT_EQ("counter", c.str());
+}
+
+TEST(Symbol, OrderByImage)
+{
+    util::symbol z("zeta");
+    util::symbol a("alpha");
+    util::symbol m("mu");
+
+    ASSERT_TRUE(a < m);
+    ASSERT_TRUE(m < z);
+    ASSERT_FALSE(z < a);
+    ASSERT_FALSE(a < util::symbol("alpha"));
+}